@@ -493,6 +493,11 @@ macro (CONFIGURE_AND_INSTALL_VERSION_HEADER)
   endif()
 endmacro()
 
+# Macro to configure and install Standard_Config.hxx file
+macro (CONFIGURE_AND_INSTALL_CONFIG_HEADER)
+  OCCT_CONFIGURE_AND_INSTALL ("adm/templates/Standard_Config.hxx.in" "${INSTALL_DIR_INCLUDE}/Standard_Config.hxx" "Standard_Config.hxx" "${INSTALL_DIR}/${INSTALL_DIR_INCLUDE}")
+endmacro()
+
 function(ADD_PRECOMPILED_HEADER INPUT_TARGET PRECOMPILED_HEADER THE_IS_PRIVATE)
   if (NOT BUILD_USE_PCH)
     return()
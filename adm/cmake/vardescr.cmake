@@ -36,6 +36,13 @@ set (BUILD_RELEASE_DISABLE_EXCEPTIONS_DESCR
 Defines No_Exception macros for Release builds when enabled (default).
 These exceptions are always enabled in Debug builds, but disable in Release for better performance")
 
+set (BUILD_NONATOMIC_REFCOUNT_DESCR
+"Use a plain (non-atomic) reference counter in transient objects (OCCT_NONATOMIC_REFCOUNT macro).
+Copying of handles becomes cheaper, but objects cannot be shared between threads anymore:
+OSD_Parallel and OSD_ThreadPool execute all the work in the calling thread, and objects
+must not be passed to threads created by other means. The choice is recorded in the generated
+Standard_Config.hxx header. Disabled by default.")
+
 set (BUILD_ENABLE_FPE_SIGNAL_HANDLER_DESCR
 "Enable/Disable the floating point exceptions (FPE) during DRAW execution only.
 Corresponding environment variable (CSF_FPE) can be changed manually
@@ -156,6 +156,129 @@ void BSplCLib_Cache::CalculateDerivative(const Standard_Real&    theParameter,
     PLib1::RationalDerivative(aDerivative, aDerivative, aDimension - 1, aPntDeriv[0], theDerivArray);
 }
 
+namespace
+{
+//! Number of points evaluated together by the batch methods
+static const Standard_Integer THE_BATCH_SIZE = 4;
+
+//! Evaluates the polynomial of degree theDegree with coefficients theCoeffs
+//! (theDegree + 1 rows of Dim values) on theNbPoints normalized parameters by Horner scheme.
+//! The loop on the points is the inner one to let the compiler vectorize it,
+//! while the sequence of operations for each point is the same as in
+//! PLib1::NoDerivativeEvalPolynomial(), so that the results are identical.
+template <int Dim>
+inline void evalPolynomialBatch(const Standard_Real*   theCoeffs,
+                                const Standard_Integer theDegree,
+                                const Standard_Real*   theParams,
+                                const Standard_Integer theNbPoints,
+                                Standard_Real (*theResults)[THE_BATCH_SIZE])
+{
+  const Standard_Real* aCoeffs = theCoeffs + theDegree * Dim;
+  for (Standard_Integer aDim = 0; aDim < Dim; ++aDim)
+  {
+    for (Standard_Integer aPnt = 0; aPnt < theNbPoints; ++aPnt)
+    {
+      theResults[aDim][aPnt] = aCoeffs[aDim];
+    }
+  }
+  for (Standard_Integer aDeg = 0; aDeg < theDegree; ++aDeg)
+  {
+    aCoeffs -= Dim;
+    for (Standard_Integer aDim = 0; aDim < Dim; ++aDim)
+    {
+      for (Standard_Integer aPnt = 0; aPnt < theNbPoints; ++aPnt)
+      {
+        theResults[aDim][aPnt] = theResults[aDim][aPnt] * theParams[aPnt] + aCoeffs[aDim];
+      }
+    }
+  }
+}
+
+//! Fills the point from the results of batch evaluation
+inline void setBatchPoint(const Standard_Real (*theResults)[THE_BATCH_SIZE],
+                          const Standard_Integer theIndex,
+                          const Standard_Boolean theIsRational,
+                          gp_Pnt2d&              thePoint)
+{
+  thePoint.SetCoord(theResults[0][theIndex], theResults[1][theIndex]);
+  if (theIsRational)
+    thePoint.ChangeCoord().Divide(theResults[2][theIndex]);
+}
+
+//! Fills the point from the results of batch evaluation
+inline void setBatchPoint(const Standard_Real (*theResults)[THE_BATCH_SIZE],
+                          const Standard_Integer theIndex,
+                          const Standard_Boolean theIsRational,
+                          Point3d&               thePoint)
+{
+  thePoint.SetCoord(theResults[0][theIndex], theResults[1][theIndex], theResults[2][theIndex]);
+  if (theIsRational)
+    thePoint.ChangeCoord().Divide(theResults[3][theIndex]);
+}
+
+//! Batch evaluation of points for BSplCLib_Cache::D0()
+template <class PointType, class ArrayType>
+Standard_Integer evalBatchD0(const CacheParams&          theParams,
+                             const Standard_Boolean      theIsRational,
+                             const TColStd_Array2OfReal& thePolesWeights,
+                             const TColStd_Array1OfReal& theParameters,
+                             const Standard_Integer      theFrom,
+                             ArrayType&                  thePoints)
+{
+  const Standard_Real* aPolesArray =
+    &thePolesWeights(thePolesWeights.LowerRow(), thePolesWeights.LowerCol());
+  const Standard_Integer aDimension = thePolesWeights.RowLength();
+
+  Standard_Real    aNewParams[THE_BATCH_SIZE];
+  Standard_Real    aResults[4][THE_BATCH_SIZE];
+  Standard_Integer anIndex = theFrom;
+  while (anIndex <= theParameters.Upper())
+  {
+    // collect the next parameters belonging to the span
+    Standard_Integer aNbPoints = 0;
+    for (; aNbPoints < THE_BATCH_SIZE && anIndex + aNbPoints <= theParameters.Upper(); ++aNbPoints)
+    {
+      const Standard_Real aParam = theParameters(anIndex + aNbPoints);
+      if (!theParams.IsCacheValid(aParam))
+      {
+        break;
+      }
+      // divide by the span length as D0() does to get the same normalized parameter
+      aNewParams[aNbPoints] =
+        (theParams.PeriodicNormalization(aParam) - theParams.SpanStart) / theParams.SpanLength;
+    }
+    if (aNbPoints == 0)
+    {
+      break;
+    }
+
+    switch (aDimension)
+    {
+      case 2:
+        evalPolynomialBatch<2>(aPolesArray, theParams.Degree, aNewParams, aNbPoints, aResults);
+        break;
+      case 3:
+        evalPolynomialBatch<3>(aPolesArray, theParams.Degree, aNewParams, aNbPoints, aResults);
+        break;
+      default:
+        evalPolynomialBatch<4>(aPolesArray, theParams.Degree, aNewParams, aNbPoints, aResults);
+        break;
+    }
+    for (Standard_Integer aPnt = 0; aPnt < aNbPoints; ++aPnt, ++anIndex)
+    {
+      PointType& aPoint = thePoints.ChangeValue(anIndex);
+      setBatchPoint(aResults, aPnt, theIsRational, aPoint);
+    }
+    if (aNbPoints < THE_BATCH_SIZE)
+    {
+      // either the end of the parameters or the end of the span is reached
+      break;
+    }
+  }
+  return anIndex;
+}
+} // namespace
+
 void BSplCLib_Cache::D0(const Standard_Real& theParameter, gp_Pnt2d& thePoint) const
 {
   Standard_Real aNewParameter = myParams.PeriodicNormalization(theParameter);
@@ -198,6 +321,30 @@ void BSplCLib_Cache::D0(const Standard_Real& theParameter, Point3d& thePoint) co
     thePoint.ChangeCoord().Divide(aPoint[3]);
 }
 
+Standard_Integer BSplCLib_Cache::D0(const TColStd_Array1OfReal& theParameters,
+                                    const Standard_Integer      theFrom,
+                                    TColgp_Array1OfPnt2d&       thePoints) const
+{
+  return evalBatchD0<gp_Pnt2d>(myParams,
+                               myIsRational,
+                               myPolesWeights->Array2(),
+                               theParameters,
+                               theFrom,
+                               thePoints);
+}
+
+Standard_Integer BSplCLib_Cache::D0(const TColStd_Array1OfReal& theParameters,
+                                    const Standard_Integer      theFrom,
+                                    TColgp_Array1OfPnt&         thePoints) const
+{
+  return evalBatchD0<Point3d>(myParams,
+                              myIsRational,
+                              myPolesWeights->Array2(),
+                              theParameters,
+                              theFrom,
+                              thePoints);
+}
+
 void BSplCLib_Cache::D1(const Standard_Real& theParameter,
                         gp_Pnt2d&            thePoint,
                         gp_Vec2d&            theTangent) const
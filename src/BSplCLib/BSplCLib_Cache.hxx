@@ -78,6 +78,23 @@ public:
   Standard_EXPORT void D0(const Standard_Real& theParameter, gp_Pnt2d& thePoint) const;
   Standard_EXPORT void D0(const Standard_Real& theParameter, Point3d& thePoint) const;
 
+  //! Calculates the points on the curve for a sequence of parameters.
+  //! The calculation starts from the parameter with index theFrom and stops
+  //! on the first parameter out of the span of the cache, so that the caller
+  //! could rebuild the cache there and continue. The polynomial of the span
+  //! is evaluated on several points at once.
+  //! \param[in]  theParameters parameters of calculation of the values
+  //! \param[in]  theFrom       index of the first parameter to be calculated
+  //! \param[out] thePoints     the results of calculation, indexed as theParameters
+  //! \return index of the first parameter which is not calculated
+  //!         (theParameters.Upper() + 1 if all the points are calculated)
+  Standard_EXPORT Standard_Integer D0(const TColStd_Array1OfReal& theParameters,
+                                      const Standard_Integer      theFrom,
+                                      TColgp_Array1OfPnt2d&       thePoints) const;
+  Standard_EXPORT Standard_Integer D0(const TColStd_Array1OfReal& theParameters,
+                                      const Standard_Integer      theFrom,
+                                      TColgp_Array1OfPnt&         thePoints) const;
+
   //! Calculates the point on the curve and its first derivative in the specified parameter
   //! \param[in]  theParameter parameter of calculation of the value
   //! \param[out] thePoint     the result of calculation (the point on the curve)
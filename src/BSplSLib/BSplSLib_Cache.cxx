@@ -153,6 +153,93 @@ void BSplSLib_Cache::D0(const Standard_Real& theU,
     thePoint.ChangeCoord().Divide(aPoint[3]);
 }
 
+Standard_Integer BSplSLib_Cache::D0(const TColStd_Array1OfReal& theU,
+                                    const TColStd_Array1OfReal& theV,
+                                    const Standard_Integer      theFrom,
+                                    TColgp_Array1OfPnt&         thePoints) const
+{
+  // BSplSLib1 uses different convention for span parameters than BSplCLib1
+  // (Start is in the middle of the span and length is half-span),
+  // thus we need to amend them here
+  const Standard_Real aSpanLengthU = 0.5 * myParamsU.SpanLength;
+  const Standard_Real aSpanStartU  = myParamsU.SpanStart + aSpanLengthU;
+  const Standard_Real aSpanLengthV = 0.5 * myParamsV.SpanLength;
+  const Standard_Real aSpanStartV  = myParamsV.SpanStart + aSpanLengthV;
+
+  Standard_Real* aPolesArray = ConvertArray(myPolesWeights);
+  Standard_Real  aPoint[4];
+
+  const Standard_Integer aDimension       = myIsRational ? 4 : 3;
+  const Standard_Integer aCacheCols       = myPolesWeights->RowLength();
+  const Standard_Integer aMinMaxDegree[2] = {Min(myParamsU.Degree, myParamsV.Degree),
+                                             Max(myParamsU.Degree, myParamsV.Degree)};
+  const Standard_Boolean isSwapped        = myParamsU.Degree > myParamsV.Degree;
+
+  // array for intermediate results, shared by all the points
+  NCollection_LocalArray<Standard_Real> aTransientCoeffs(aCacheCols);
+
+  Standard_Integer anIndex = theFrom;
+  for (; anIndex <= theU.Upper(); ++anIndex)
+  {
+    const Standard_Real aU = theU(anIndex);
+    const Standard_Real aV = theV(anIndex);
+    if (!myParamsU.IsCacheValid(aU) || !myParamsV.IsCacheValid(aV))
+    {
+      break;
+    }
+
+    const Standard_Real aNewU = (myParamsU.PeriodicNormalization(aU) - aSpanStartU) / aSpanLengthU;
+    const Standard_Real aNewV = (myParamsV.PeriodicNormalization(aV) - aSpanStartV) / aSpanLengthV;
+
+    // Calculate intermediate value of cached polynomial along columns
+    PLib1::NoDerivativeEvalPolynomial(isSwapped ? aNewU : aNewV,
+                                     aMinMaxDegree[1],
+                                     aCacheCols,
+                                     aMinMaxDegree[1] * aCacheCols,
+                                     aPolesArray[0],
+                                     aTransientCoeffs[0]);
+
+    // Calculate total value
+    PLib1::NoDerivativeEvalPolynomial(isSwapped ? aNewV : aNewU,
+                                     aMinMaxDegree[0],
+                                     aDimension,
+                                     aDimension * aMinMaxDegree[0],
+                                     aTransientCoeffs[0],
+                                     aPoint[0]);
+
+    Point3d& aPnt = thePoints.ChangeValue(anIndex);
+    aPnt.SetCoord(aPoint[0], aPoint[1], aPoint[2]);
+    if (myIsRational)
+      aPnt.ChangeCoord().Divide(aPoint[3]);
+  }
+  return anIndex;
+}
+
+Standard_Integer BSplSLib_Cache::D1(const TColStd_Array1OfReal& theU,
+                                    const TColStd_Array1OfReal& theV,
+                                    const Standard_Integer      theFrom,
+                                    TColgp_Array1OfPnt&         thePoints,
+                                    TColgp_Array1OfVec&         theTangentU,
+                                    TColgp_Array1OfVec&         theTangentV) const
+{
+  Standard_Integer anIndex = theFrom;
+  for (; anIndex <= theU.Upper(); ++anIndex)
+  {
+    const Standard_Real aU = theU(anIndex);
+    const Standard_Real aV = theV(anIndex);
+    if (!myParamsU.IsCacheValid(aU) || !myParamsV.IsCacheValid(aV))
+    {
+      break;
+    }
+    D1(aU,
+       aV,
+       thePoints.ChangeValue(anIndex),
+       theTangentU.ChangeValue(anIndex),
+       theTangentV.ChangeValue(anIndex));
+  }
+  return anIndex;
+}
+
 void BSplSLib_Cache::D1(const Standard_Real& theU,
                         const Standard_Real& theV,
                         Point3d&              thePoint,
@@ -16,6 +16,8 @@
 
 #include <TColStd_HArray2OfReal.hxx>
 #include <TColStd_Array2OfReal.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfVec.hxx>
 
 #include <BSplCLib_CacheParams.hxx>
 
@@ -104,6 +106,38 @@ public:
                           Vector3d&              theCurvatureV,
                           Vector3d&              theCurvatureUV) const;
 
+  //! Calculates the points on the surface for a sequence of parameters.
+  //! The calculation starts from the parameters with index theFrom and stops
+  //! on the first couple of parameters out of the span of the cache, so that
+  //! the caller could rebuild the cache there and continue.
+  //! \param[in]  theU      first parameters of calculation of the values
+  //! \param[in]  theV      second parameters of calculation of the values, indexed as theU
+  //! \param[in]  theFrom   index of the first parameters to be calculated
+  //! \param[out] thePoints the results of calculation, indexed as theU
+  //! \return index of the first parameters which are not calculated
+  //!         (theU.Upper() + 1 if all the points are calculated)
+  Standard_EXPORT Standard_Integer D0(const TColStd_Array1OfReal& theU,
+                                      const TColStd_Array1OfReal& theV,
+                                      const Standard_Integer      theFrom,
+                                      TColgp_Array1OfPnt&         thePoints) const;
+
+  //! Calculates the points on the surface and the first derivatives for a sequence of parameters.
+  //! The calculation stops on the first couple of parameters out of the span of the cache.
+  //! \param[in]  theU        first parameters of calculation of the values
+  //! \param[in]  theV        second parameters of calculation of the values, indexed as theU
+  //! \param[in]  theFrom     index of the first parameters to be calculated
+  //! \param[out] thePoints   the points on the surface, indexed as theU
+  //! \param[out] theTangentU tangent vectors along U axis, indexed as theU
+  //! \param[out] theTangentV tangent vectors along V axis, indexed as theU
+  //! \return index of the first parameters which are not calculated
+  //!         (theU.Upper() + 1 if all the points are calculated)
+  Standard_EXPORT Standard_Integer D1(const TColStd_Array1OfReal& theU,
+                                      const TColStd_Array1OfReal& theV,
+                                      const Standard_Integer      theFrom,
+                                      TColgp_Array1OfPnt&         thePoints,
+                                      TColgp_Array1OfVec&         theTangentU,
+                                      TColgp_Array1OfVec&         theTangentV) const;
+
   DEFINE_STANDARD_RTTIEXT(BSplSLib_Cache, RefObject)
 
 private:
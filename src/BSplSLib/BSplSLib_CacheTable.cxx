@@ -0,0 +1,201 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BSplSLib_CacheTable.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BSplSLib_CacheTable, RefObject)
+
+//=================================================================================================
+
+BSplSLib_CacheTable::BSplSLib_CacheTable(const Standard_Integer&     theDegreeU,
+                                         const Standard_Boolean&     thePeriodicU,
+                                         const TColStd_Array1OfReal& theFlatKnotsU,
+                                         const Standard_Integer&     theDegreeV,
+                                         const Standard_Boolean&     thePeriodicV,
+                                         const TColStd_Array1OfReal& theFlatKnotsV)
+    : myDegreeU(theDegreeU),
+      myDegreeV(theDegreeV),
+      myIsPeriodicU(thePeriodicU),
+      myIsPeriodicV(thePeriodicV),
+      mySpanIndexMinU(theFlatKnotsU.Lower() + theDegreeU),
+      mySpanIndexMinV(theFlatKnotsV.Lower() + theDegreeV),
+      myNbSpansU(Max(theFlatKnotsU.Length() - 2 * theDegreeU - 1, 0)),
+      myNbSpansV(Max(theFlatKnotsV.Length() - 2 * theDegreeV - 1, 0)),
+      myMaxNbCaches(THE_DEFAULT_MAX_NB_CACHES),
+      myRows(NULL),
+      myNbCaches(0)
+{
+  if (myNbSpansU > 0 && myNbSpansV > 0)
+  {
+    // the slots of a row are allocated on its first request
+    myRows = new std::atomic<Slot*>[myNbSpansU];
+    for (Standard_Integer aSpanU = 0; aSpanU < myNbSpansU; ++aSpanU)
+    {
+      myRows[aSpanU].store(NULL);
+    }
+  }
+}
+
+//=================================================================================================
+
+BSplSLib_CacheTable::~BSplSLib_CacheTable()
+{
+  for (Standard_Integer aSpanU = 0; myRows != NULL && aSpanU < myNbSpansU; ++aSpanU)
+  {
+    Slot* aRow = myRows[aSpanU].load();
+    for (Standard_Integer aSpanV = 0; aRow != NULL && aSpanV < myNbSpansV; ++aSpanV)
+    {
+      release(aRow[aSpanV]);
+    }
+    delete[] aRow;
+  }
+  delete[] myRows;
+}
+
+//=================================================================================================
+
+Handle(BSplSLib_Cache) BSplSLib_CacheTable::Cache(const Standard_Real&        theParameterU,
+                                                  const Standard_Real&        theParameterV,
+                                                  const TColStd_Array1OfReal& theFlatKnotsU,
+                                                  const TColStd_Array1OfReal& theFlatKnotsV,
+                                                  const TColgp_Array2OfPnt&   thePoles,
+                                                  const TColStd_Array2OfReal* theWeights) const
+{
+  // locate the span in the same way as the cache does
+  CacheParams   aParamsU(myDegreeU, myIsPeriodicU, theFlatKnotsU);
+  CacheParams   aParamsV(myDegreeV, myIsPeriodicV, theFlatKnotsV);
+  Standard_Real aNewParamU = aParamsU.PeriodicNormalization(theParameterU);
+  Standard_Real aNewParamV = aParamsV.PeriodicNormalization(theParameterV);
+  aParamsU.LocateParameter(aNewParamU, theFlatKnotsU);
+  aParamsV.LocateParameter(aNewParamV, theFlatKnotsV);
+
+  const Standard_Integer aSpanU = aParamsU.SpanIndex - mySpanIndexMinU;
+  const Standard_Integer aSpanV = aParamsV.SpanIndex - mySpanIndexMinV;
+
+  const Standard_Boolean isInTable =
+    aSpanU >= 0 && aSpanU < myNbSpansU && aSpanV >= 0 && aSpanV < myNbSpansV;
+  Slot* aSlot = NULL;
+  if (isInTable)
+  {
+    aSlot = row(aSpanU) + aSpanV;
+    if (BSplSLib_Cache* aCache = aSlot->load(std::memory_order_acquire))
+    {
+      // the published cache is never changed, it is released only by the destructor
+      // or by SetMaxNbCaches() which are not called concurrently
+      return aCache;
+    }
+  }
+
+  Handle(BSplSLib_Cache) aCache = new BSplSLib_Cache(myDegreeU,
+                                                     myIsPeriodicU,
+                                                     theFlatKnotsU,
+                                                     myDegreeV,
+                                                     myIsPeriodicV,
+                                                     theFlatKnotsV,
+                                                     theWeights);
+  aCache->BuildCache(theParameterU,
+                     theParameterV,
+                     theFlatKnotsU,
+                     theFlatKnotsV,
+                     thePoles,
+                     theWeights);
+  if (aSlot == NULL)
+  {
+    // should not happen, but the private cache is still a valid answer
+    return aCache;
+  }
+  return publish(*aSlot, aCache);
+}
+
+//=================================================================================================
+
+void BSplSLib_CacheTable::SetMaxNbCaches(const Standard_Integer theNbCaches)
+{
+  myMaxNbCaches = Max(theNbCaches, 1);
+  for (Standard_Integer aSpanU = 0; myRows != NULL && aSpanU < myNbSpansU; ++aSpanU)
+  {
+    Slot* aRow = myRows[aSpanU].load();
+    for (Standard_Integer aSpanV = 0;
+         aRow != NULL && aSpanV < myNbSpansV && myNbCaches.load() > myMaxNbCaches;
+         ++aSpanV)
+    {
+      release(aRow[aSpanV]);
+    }
+  }
+}
+
+//=================================================================================================
+
+BSplSLib_CacheTable::Slot* BSplSLib_CacheTable::row(const Standard_Integer theSpanU) const
+{
+  Slot* aRow = myRows[theSpanU].load(std::memory_order_acquire);
+  if (aRow != NULL)
+  {
+    return aRow;
+  }
+
+  Slot* aNewRow = new Slot[myNbSpansV];
+  for (Standard_Integer aSpanV = 0; aSpanV < myNbSpansV; ++aSpanV)
+  {
+    aNewRow[aSpanV].store(NULL, std::memory_order_relaxed);
+  }
+  if (!myRows[theSpanU].compare_exchange_strong(aRow, aNewRow, std::memory_order_acq_rel))
+  {
+    // another thread has allocated the row first
+    delete[] aNewRow;
+    return aRow;
+  }
+  return aNewRow;
+}
+
+//=================================================================================================
+
+Handle(BSplSLib_Cache) BSplSLib_CacheTable::publish(Slot&                         theSlot,
+                                                   const Handle(BSplSLib_Cache)& theCache) const
+{
+  // reserve the place for the cache before its publication
+  if (myNbCaches.fetch_add(1) >= myMaxNbCaches)
+  {
+    --myNbCaches;
+    return theCache;
+  }
+
+  // the slot keeps its own reference to the cache
+  theCache->IncrementRefCounter();
+  BSplSLib_Cache* aPublished = NULL;
+  if (theSlot.compare_exchange_strong(aPublished, theCache.get(), std::memory_order_acq_rel))
+  {
+    return theCache;
+  }
+
+  // another thread has calculated the same span first
+  theCache->DecrementRefCounter();
+  --myNbCaches;
+  return aPublished;
+}
+
+//=================================================================================================
+
+void BSplSLib_CacheTable::release(Slot& theSlot)
+{
+  // the evaluators holding the cache keep it alive
+  BSplSLib_Cache* aCache = theSlot.exchange(NULL);
+  if (aCache != NULL)
+  {
+    --myNbCaches;
+    if (aCache->DecrementRefCounter() == 0)
+    {
+      aCache->Delete();
+    }
+  }
+}
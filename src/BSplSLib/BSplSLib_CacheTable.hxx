@@ -0,0 +1,126 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BSplSLib_CacheTable_Headerfile
+#define _BSplSLib_CacheTable_Headerfile
+
+#include <BSplSLib_Cache.hxx>
+#include <TColgp_Array2OfPnt.hxx>
+
+#include <atomic>
+
+//! \brief A table of caches of the spans of a B-spline surface.
+//!
+//! The cache of a span is calculated on the first request and is never changed after that,
+//! thus it can be shared by several evaluators of the same surface working in different threads,
+//! without recalculating the caches of the spans already visited by others.
+//! The caches returned by the table must not be rebuilt by the caller.
+//!
+//! A calculated cache is published in the slot of its span by an atomic operation,
+//! so that the requests of the spans already calculated do not take any lock.
+//! If two threads calculate the same span at once, the cache published first is kept.
+//!
+//! The number of kept caches is limited: as soon as the limit is reached, the caches
+//! of the other spans are calculated for the caller only and are not kept by the table.
+class BSplSLib_CacheTable : public RefObject
+{
+public:
+  //! Default maximum number of caches kept by the table.
+  static const Standard_Integer THE_DEFAULT_MAX_NB_CACHES = 256;
+
+public:
+  //! Constructor, prepares the table for the spans of the surface
+  //! \param theDegreeU    degree along the first parameter (U) of the surface
+  //! \param thePeriodicU  identify the surface is periodical along U axis
+  //! \param theFlatKnotsU knots of the surface (with repetition) along U axis
+  //! \param theDegreeV    degree along the second parameter (V) of the surface
+  //! \param thePeriodicV  identify the surface is periodical along V axis
+  //! \param theFlatKnotsV knots of the surface (with repetition) along V axis
+  Standard_EXPORT BSplSLib_CacheTable(const Standard_Integer&     theDegreeU,
+                                      const Standard_Boolean&     thePeriodicU,
+                                      const TColStd_Array1OfReal& theFlatKnotsU,
+                                      const Standard_Integer&     theDegreeV,
+                                      const Standard_Boolean&     thePeriodicV,
+                                      const TColStd_Array1OfReal& theFlatKnotsV);
+
+  //! Returns the cache of the span containing the point with specified parameters.
+  //! The cache is calculated if it is requested for the first time
+  //! or if it is not kept by the table because of the limit of the number of caches.
+  //! The data of the surface should be the same as the ones used to create the table.
+  //! \param theParameterU  the parametric value on the U axis to identify the span
+  //! \param theParameterV  the parametric value on the V axis to identify the span
+  //! \param theFlatKnotsU  flat knots of the surface along U axis
+  //! \param theFlatKnotsV  flat knots of the surface along V axis
+  //! \param thePoles       array of poles of the surface
+  //! \param theWeights     array of weights of corresponding poles
+  Standard_EXPORT Handle(BSplSLib_Cache) Cache(const Standard_Real&        theParameterU,
+                                               const Standard_Real&        theParameterV,
+                                               const TColStd_Array1OfReal& theFlatKnotsU,
+                                               const TColStd_Array1OfReal& theFlatKnotsV,
+                                               const TColgp_Array2OfPnt&   thePoles,
+                                               const TColStd_Array2OfReal* theWeights = NULL) const;
+
+  //! Returns maximum number of caches kept by the table.
+  Standard_Integer MaxNbCaches() const { return myMaxNbCaches; }
+
+  //! Sets maximum number of caches kept by the table (at least one cache is always kept).
+  //! Releases the kept caches if the new limit is exceeded, the released caches stay valid
+  //! for the evaluators still holding them. Should not be called concurrently with Cache().
+  Standard_EXPORT void SetMaxNbCaches(const Standard_Integer theNbCaches);
+
+  //! Returns number of caches kept by the table.
+  Standard_Integer NbCaches() const { return myNbCaches.load(); }
+
+  //! Destructor, releases the kept caches.
+  Standard_EXPORT virtual ~BSplSLib_CacheTable();
+
+  DEFINE_STANDARD_RTTIEXT(BSplSLib_CacheTable, RefObject)
+
+private:
+  //! Slot of a span holding a reference to its cache, NULL until the cache is published.
+  typedef std::atomic<BSplSLib_Cache*> Slot;
+
+  //! Returns the slots of the spans with the given index along U axis,
+  //! allocates them on the first request.
+  Slot* row(const Standard_Integer theSpanU) const;
+
+  //! Publishes the cache in the slot if the limit of the number of caches allows it.
+  //! Returns the cache published in the slot or the given one if it cannot be kept.
+  Handle(BSplSLib_Cache) publish(Slot& theSlot, const Handle(BSplSLib_Cache)& theCache) const;
+
+  //! Releases the cache kept in the slot.
+  void release(Slot& theSlot);
+
+private:
+  // copying is prohibited
+  BSplSLib_CacheTable(const BSplSLib_CacheTable&);
+  void operator=(const BSplSLib_CacheTable&);
+
+private:
+  Standard_Integer myDegreeU;       //!< degree along U axis
+  Standard_Integer myDegreeV;       //!< degree along V axis
+  Standard_Boolean myIsPeriodicU;   //!< periodicity along U axis
+  Standard_Boolean myIsPeriodicV;   //!< periodicity along V axis
+  Standard_Integer mySpanIndexMinU; //!< minimal index of span along U axis
+  Standard_Integer mySpanIndexMinV; //!< minimal index of span along V axis
+  Standard_Integer myNbSpansU;      //!< number of spans (including empty ones) along U axis
+  Standard_Integer myNbSpansV;      //!< number of spans (including empty ones) along V axis
+  Standard_Integer myMaxNbCaches;   //!< maximum number of kept caches
+
+  std::atomic<Slot*>*                   myRows;     //!< slots of the spans by index along U axis
+  mutable std::atomic<Standard_Integer> myNbCaches; //!< number of kept caches
+};
+
+DEFINE_STANDARD_HANDLE(BSplSLib_CacheTable, RefObject)
+
+#endif
@@ -27,12 +27,36 @@
 #include <Standard_NotImplemented.hxx>
 #include <TCollection_ExtendedString.hxx>
 #include <TNaming_NamedShape.hxx>
+#include <CDM_Application.hxx>
+#include <CDM_Document.hxx>
+#include <PCDM_ReaderFilter.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(BinDrivers_DocumentRetrievalDriver, BinLDrivers_DocumentRetrievalDriver)
 
 //=================================================================================================
 
-BinDrivers_DocumentRetrievalDriver::BinDrivers_DocumentRetrievalDriver() {}
+BinDrivers_DocumentRetrievalDriver::BinDrivers_DocumentRetrievalDriver()
+    : myToDeferTriangulations(Standard_False)
+{
+}
+
+//=================================================================================================
+
+void BinDrivers_DocumentRetrievalDriver::Read(const UtfString& theFileName,
+                                              const Handle(CDM_Document)&       theNewDocument,
+                                              const Handle(CDM_Application)&    theApplication,
+                                              const Handle(ReaderFilter)&       theFilter,
+                                              const Message_ProgressRange&      theRange)
+{
+  // positions in the file stream are used to load triangulations on request
+  myFileName = myToDeferTriangulations ? AsciiString1(theFileName) : AsciiString1();
+  BinLDrivers_DocumentRetrievalDriver::Read(theFileName,
+                                            theNewDocument,
+                                            theApplication,
+                                            theFilter,
+                                            theRange);
+  myFileName.Clear();
+}
 
 //=================================================================================================
 
@@ -90,7 +114,9 @@ void BinDrivers_DocumentRetrievalDriver::Clear()
     Handle(BinMNaming_NamedShapeDriver) aNamedShapeDriver =
       Handle(BinMNaming_NamedShapeDriver)::DownCast(aDriver);
     aNamedShapeDriver->Clear();
+    aNamedShapeDriver->SetDeferredTriangulationFile(AsciiString1());
   }
+  myFileName.Clear();
   BinLDrivers_DocumentRetrievalDriver::Clear();
 }
 
@@ -113,4 +139,45 @@ void BinDrivers_DocumentRetrievalDriver::EnableQuickPartReading(
     throw Standard_NotImplemented("Internal Error - ShapeAttribute is not found!");
 
   aShapesDriver->EnableQuickPart(theValue);
+  // deferred triangulations are loaded from raw file positions, not available in compressed chunks
+  aShapesDriver->SetDeferredTriangulationFile(theValue && !myIsChunked ? myFileName
+                                                                        : AsciiString1());
+}
+
+//=================================================================================================
+
+Handle(PCDM_RetrievalDriver) BinDrivers_DocumentRetrievalDriver::Copy() const
+{
+  Handle(BinDrivers_DocumentRetrievalDriver) aCopy = new BinDrivers_DocumentRetrievalDriver();
+  if (!InitCopy(aCopy))
+  {
+    return Handle(PCDM_RetrievalDriver)();
+  }
+  return aCopy;
+}
+
+//=================================================================================================
+
+Standard_Boolean BinDrivers_DocumentRetrievalDriver::InitCopy(
+  const Handle(BinDrivers_DocumentRetrievalDriver)& theCopy) const
+{
+  BinLDrivers_DocumentRetrievalDriver::InitCopy(theCopy);
+  theCopy->SetDeferredTriangulations(myToDeferTriangulations);
+  if (theCopy->myDrivers.IsNull())
+  {
+    return Standard_True;
+  }
+
+  Handle(BinMDF_ADriver) aDriver;
+  theCopy->myDrivers->GetDriver(STANDARD_TYPE(ShapeAttribute), aDriver);
+  if (aDriver.IsNull())
+  {
+    return Standard_True;
+  }
+  if (aDriver->DynamicType() != STANDARD_TYPE(BinMNaming_NamedShapeDriver))
+  {
+    return Standard_False;
+  }
+  theCopy->myDrivers->AddDriver(new BinMNaming_NamedShapeDriver(aDriver->MessageDriver()));
+  return Standard_True;
 }
@@ -22,6 +22,7 @@
 #include <Standard_IStream.hxx>
 #include <Storage_Position.hxx>
 #include <Standard_Integer.hxx>
+#include <TCollection_AsciiString.hxx>
 class AttributeDriverTable;
 class Message_Messenger;
 class DocumentSection;
@@ -36,9 +37,34 @@ public:
   //! Constructor
   Standard_EXPORT BinDrivers_DocumentRetrievalDriver();
 
+  //! Retrieves the content of the file into a new Document.
+  //! Triangulations of shapes are left in the file if IsDeferredTriangulations() is set.
+  Standard_EXPORT virtual void Read(
+    const UtfString&            theFileName,
+    const Handle(CDM_Document)&    theNewDocument,
+    const Handle(CDM_Application)& theApplication,
+    const Handle(ReaderFilter)&    theFilter   = Handle(ReaderFilter)(),
+    const Message_ProgressRange&   theProgress = Message_ProgressRange()) Standard_OVERRIDE;
+
+  using BinLDrivers_DocumentRetrievalDriver::Read;
+
   Standard_EXPORT virtual Handle(AttributeDriverTable) AttributeDrivers(
     const Handle(Message_Messenger)& theMsgDriver) Standard_OVERRIDE;
 
+  //! Returns TRUE if triangulations of shapes are loaded on request; FALSE by default.
+  Standard_Boolean IsDeferredTriangulations() const { return myToDeferTriangulations; }
+
+  //! Sets whether to leave triangulations of shapes in the file while opening it.
+  //! The faces get triangulations of BinTools_DeferredTriangulation type without nodes
+  //! and triangles, which are loaded on request by MeshTriangulation::LoadDeferredData()
+  //! or by Poly_TriangulationCache keeping the memory budget of the document.
+  //! Applies to the documents of format version 12 and later (storing shapes in attributes)
+  //! opened from a file; the file should be kept while the triangulations are in use.
+  void SetDeferredTriangulations(const Standard_Boolean theToDefer)
+  {
+    myToDeferTriangulations = theToDefer;
+  }
+
   Standard_EXPORT virtual void ReadShapeSection(
     DocumentSection& theSection,
     Standard_IStream&            theIS,
@@ -56,7 +82,21 @@ public:
     const Handle(Message_Messenger)& theMessageDriver,
     Standard_Boolean                 theValue) Standard_OVERRIDE;
 
+  //! Returns a new driver of the same type, with the format and options of this driver.
+  Standard_EXPORT virtual Handle(PCDM_RetrievalDriver) Copy() const Standard_OVERRIDE;
+
   DEFINE_STANDARD_RTTIEXT(BinDrivers_DocumentRetrievalDriver, BinLDrivers_DocumentRetrievalDriver)
+
+protected:
+  //! Passes the format, the reading options and the attribute drivers of this driver to its copy;
+  //! the copy gets its own driver of shapes, as this one keeps the shapes of the document being read.
+  //! Returns FALSE if the driver of shapes is redefined by the application and cannot be duplicated.
+  Standard_EXPORT Standard_Boolean
+    InitCopy(const Handle(BinDrivers_DocumentRetrievalDriver)& theCopy) const;
+
+private:
+  AsciiString1 myFileName; //!< file being read with deferred triangulations
+  Standard_Boolean        myToDeferTriangulations;
 };
 
 #endif // _BinDrivers_DocumentRetrievalDriver_HeaderFile
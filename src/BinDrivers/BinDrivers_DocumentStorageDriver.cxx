@@ -190,9 +190,56 @@ void BinDrivers_DocumentStorageDriver::WriteShapeSection(DocumentSection& theSec
     {
       UtfString anErrorStr("BinDrivers_DocumentStorageDriver, Shape Section :");
       myMsgDriver->Send(anErrorStr + anException.GetMessageString(), Message_Fail);
+      SetIsError(Standard_True);
+      SetStoreStatus(PCDM_SS_Failure);
     }
   }
 
   // Write the section info in the TOC.
   theSection.Write(theOS, aShapesSectionOffset, theDocVer);
 }
+
+//=================================================================================================
+
+Handle(PCDM_StorageDriver) BinDrivers_DocumentStorageDriver::Copy() const
+{
+  Handle(BinDrivers_DocumentStorageDriver) aCopy = new BinDrivers_DocumentStorageDriver();
+  if (!InitCopy(aCopy))
+  {
+    return Handle(PCDM_StorageDriver)();
+  }
+  return aCopy;
+}
+
+//=================================================================================================
+
+Standard_Boolean BinDrivers_DocumentStorageDriver::InitCopy(
+  const Handle(BinDrivers_DocumentStorageDriver)& theCopy) const
+{
+  BinLDrivers_DocumentStorageDriver::InitCopy(theCopy);
+  if (theCopy->myDrivers.IsNull())
+  {
+    // options are not defined yet
+    return Standard_True;
+  }
+
+  Handle(BinMDF_ADriver) aDriver;
+  theCopy->myDrivers->GetDriver(STANDARD_TYPE(ShapeAttribute), aDriver);
+  if (aDriver.IsNull())
+  {
+    return Standard_True;
+  }
+  if (aDriver->DynamicType() != STANDARD_TYPE(BinMNaming_NamedShapeDriver))
+  {
+    return Standard_False;
+  }
+
+  Handle(BinMNaming_NamedShapeDriver) aShapesDriver =
+    Handle(BinMNaming_NamedShapeDriver)::DownCast(aDriver);
+  Handle(BinMNaming_NamedShapeDriver) aNewShapesDriver =
+    new BinMNaming_NamedShapeDriver(aShapesDriver->MessageDriver());
+  aNewShapesDriver->SetWithTriangles(aShapesDriver->IsWithTriangles());
+  aNewShapesDriver->SetWithNormals(aShapesDriver->IsWithNormals());
+  theCopy->myDrivers->AddDriver(aNewShapesDriver);
+  return Standard_True;
+}
@@ -64,7 +64,18 @@ public:
   //! Clears the NamedShape1 driver
   Standard_EXPORT virtual void Clear() Standard_OVERRIDE;
 
+  //! Returns a new driver of the same type, with the format and options of this driver.
+  Standard_EXPORT virtual Handle(PCDM_StorageDriver) Copy() const Standard_OVERRIDE;
+
   DEFINE_STANDARD_RTTIEXT(BinDrivers_DocumentStorageDriver, BinLDrivers_DocumentStorageDriver)
+
+protected:
+  //! Passes the format, the shapes writing options and the attribute drivers of this driver
+  //! to its copy; the copy gets its own driver of shapes, as this one keeps the shapes
+  //! of the document being written.
+  //! Returns FALSE if the driver of shapes is redefined by the application and cannot be duplicated.
+  Standard_EXPORT Standard_Boolean
+    InitCopy(const Handle(BinDrivers_DocumentStorageDriver)& theCopy) const;
 };
 
 #endif // _BinDrivers_DocumentStorageDriver_HeaderFile
@@ -0,0 +1,994 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BinLDrivers_ChunkedStreamBuffer.hxx>
+
+#include <FSD_BinaryFile.hxx>
+#include <NCollection_BaseAllocator.hxx>
+#include <OSD_Parallel.hxx>
+
+#include <limits>
+#include <string.h>
+
+namespace
+{
+//! Signature of the chunked document data.
+static const char THE_CHUNKS_MAGIC[8] = {'O', 'C', 'A', 'F', 'C', 'H', 'N', 'K'};
+
+//! Size of the container header: magic, chunk size, data offset, data size and index offset.
+static const std::streamoff THE_HEADER_SIZE = sizeof(THE_CHUNKS_MAGIC) + 4 + 8 + 8 + 8;
+
+//! Position of the data size in the container header.
+static const std::streamoff THE_DATA_SIZE_POS = sizeof(THE_CHUNKS_MAGIC) + 4 + 8;
+
+//! Minimal length of the match.
+static const Standard_Size THE_MIN_MATCH = 4;
+
+//! Number of bytes at the end of block that are always stored as literals.
+static const Standard_Size THE_LAST_LITERALS = 5;
+
+//! Number of bytes at the end of block that cannot start a match.
+static const Standard_Size THE_MATCH_LIMIT = 12;
+
+//! Maximal distance to the match.
+static const Standard_Size THE_MAX_OFFSET = 65535;
+
+//! Number of bits of the hash of 4-byte sequences.
+static const Standard_Integer THE_HASH_LOG = 14;
+
+inline uint32_t readSequence(const Standard_Byte* thePtr)
+{
+  uint32_t aValue;
+  memcpy(&aValue, thePtr, sizeof(uint32_t));
+  return aValue;
+}
+
+inline Standard_Size hashSequence(const uint32_t theSequence)
+{
+  return (Standard_Size)((theSequence * 2654435761U) >> (32 - THE_HASH_LOG));
+}
+
+//! Writes the remainder of the length exceeding 4-bit field of the token.
+inline Standard_Byte* writeLength(Standard_Byte* theDst, Standard_Size theLength)
+{
+  for (; theLength >= 255; theLength -= 255)
+  {
+    *theDst++ = 255;
+  }
+  *theDst++ = (Standard_Byte)theLength;
+  return theDst;
+}
+
+//! Reads the remainder of the length exceeding 4-bit field of the token.
+inline Standard_Boolean readLength(const Standard_Byte*& theSrc,
+                                   const Standard_Byte*  theSrcEnd,
+                                   Standard_Size&        theLength)
+{
+  Standard_Byte aByte = 255;
+  while (aByte == 255)
+  {
+    if (theSrc >= theSrcEnd)
+    {
+      return Standard_False;
+    }
+    aByte = *theSrc++;
+    theLength += aByte;
+  }
+  return Standard_True;
+}
+
+//! Computes Adler-32 checksum of the block of data.
+inline uint32_t checksum(const Standard_Byte* theData, Standard_Size theSize)
+{
+  // 5552 is the largest number of bytes which cannot overflow the sums before the reduction
+  uint32_t aSum1 = 1, aSum2 = 0;
+  while (theSize != 0)
+  {
+    const Standard_Size aBlock = std::min<Standard_Size>(theSize, 5552);
+    for (Standard_Size anIndex = 0; anIndex < aBlock; ++anIndex)
+    {
+      aSum1 += theData[anIndex];
+      aSum2 += aSum1;
+    }
+    aSum1 %= 65521;
+    aSum2 %= 65521;
+    theData += aBlock;
+    theSize -= aBlock;
+  }
+  return (aSum2 << 16) | aSum1;
+}
+
+//! Returns the space needed for the sequence of literals and the match.
+inline Standard_Size sequenceBound(const Standard_Size theNbLiterals,
+                                   const Standard_Size theMatchLength)
+{
+  return 1 + theNbLiterals / 255 + 1 + theNbLiterals + 2 + theMatchLength / 255 + 1;
+}
+
+inline void writeUint32(Standard_OStream& theOStream, const uint32_t theValue)
+{
+#if OCCT_BINARY_FILE_DO_INVERSE
+  const uint32_t aValue = (uint32_t)FSD_BinaryFile::InverseInt((Standard_Integer)theValue);
+#else
+  const uint32_t aValue = theValue;
+#endif
+  theOStream.write((const char*)&aValue, sizeof(uint32_t));
+}
+
+inline void writeUint64(Standard_OStream& theOStream, const uint64_t theValue)
+{
+#if OCCT_BINARY_FILE_DO_INVERSE
+  const uint64_t aValue = FSD_BinaryFile::InverseUint64(theValue);
+#else
+  const uint64_t aValue = theValue;
+#endif
+  theOStream.write((const char*)&aValue, sizeof(uint64_t));
+}
+
+inline Standard_Boolean readUint32(Standard_IStream& theIStream, uint32_t& theValue)
+{
+  theIStream.read((char*)&theValue, sizeof(uint32_t));
+#if OCCT_BINARY_FILE_DO_INVERSE
+  theValue = (uint32_t)FSD_BinaryFile::InverseInt((Standard_Integer)theValue);
+#endif
+  return theIStream.gcount() == sizeof(uint32_t);
+}
+
+inline Standard_Boolean readUint64(Standard_IStream& theIStream, uint64_t& theValue)
+{
+  theIStream.read((char*)&theValue, sizeof(uint64_t));
+#if OCCT_BINARY_FILE_DO_INVERSE
+  theValue = FSD_BinaryFile::InverseUint64(theValue);
+#endif
+  return theIStream.gcount() == sizeof(uint64_t);
+}
+} // namespace
+
+//=================================================================================================
+
+Standard_Size BinLDrivers_ChunkedStreamBuffer::Compress(const Standard_Byte* theSrc,
+                                                        const Standard_Size  theSrcSize,
+                                                        Standard_Byte*       theDst,
+                                                        const Standard_Size  theDstCapacity)
+{
+  Standard_Byte*       aDst    = theDst;
+  Standard_Byte* const aDstEnd = theDst + theDstCapacity;
+  Standard_Size        anAnchor = 0;
+  if (theSrcSize > THE_MATCH_LIMIT)
+  {
+    // greedy search of matches by the hash of 4-byte sequences,
+    // skipping faster through the data that does not compress
+    NCollection_Array1<Standard_Size> aTable(0, (1 << THE_HASH_LOG) - 1);
+    aTable.Init(0);
+    const Standard_Size aLimit    = theSrcSize - THE_MATCH_LIMIT;
+    const Standard_Size aMatchEnd = theSrcSize - THE_LAST_LITERALS;
+    Standard_Size       aNbMisses = 0;
+    for (Standard_Size aPos = 1; aPos < aLimit;)
+    {
+      const uint32_t      aSequence = readSequence(theSrc + aPos);
+      const Standard_Size aHash     = hashSequence(aSequence);
+      const Standard_Size aRef      = aTable(aHash);
+      aTable(aHash)                 = aPos;
+      if (aRef >= aPos || aPos - aRef > THE_MAX_OFFSET || readSequence(theSrc + aRef) != aSequence)
+      {
+        aPos += 1 + (aNbMisses++ >> 6);
+        continue;
+      }
+
+      Standard_Size aLength = THE_MIN_MATCH;
+      while (aPos + aLength < aMatchEnd && theSrc[aRef + aLength] == theSrc[aPos + aLength])
+      {
+        ++aLength;
+      }
+
+      const Standard_Size aNbLiterals = aPos - anAnchor;
+      const Standard_Size aMatchLength = aLength - THE_MIN_MATCH;
+      if (sequenceBound(aNbLiterals, aMatchLength) > (Standard_Size)(aDstEnd - aDst))
+      {
+        return 0;
+      }
+
+      Standard_Byte* aToken = aDst++;
+      *aToken               = (Standard_Byte)(std::min<Standard_Size>(aNbLiterals, 15) << 4);
+      if (aNbLiterals >= 15)
+      {
+        aDst = writeLength(aDst, aNbLiterals - 15);
+      }
+      memcpy(aDst, theSrc + anAnchor, aNbLiterals);
+      aDst += aNbLiterals;
+
+      const Standard_Size anOffset = aPos - aRef;
+      *aDst++                      = (Standard_Byte)(anOffset & 0xFF);
+      *aDst++                      = (Standard_Byte)(anOffset >> 8);
+      *aToken |= (Standard_Byte)std::min<Standard_Size>(aMatchLength, 15);
+      if (aMatchLength >= 15)
+      {
+        aDst = writeLength(aDst, aMatchLength - 15);
+      }
+
+      aPos += aLength;
+      anAnchor  = aPos;
+      aNbMisses = 0;
+    }
+  }
+
+  // the last sequence consists of literals only
+  const Standard_Size aNbLiterals = theSrcSize - anAnchor;
+  if (sequenceBound(aNbLiterals, 0) > (Standard_Size)(aDstEnd - aDst))
+  {
+    return 0;
+  }
+  *aDst++ = (Standard_Byte)(std::min<Standard_Size>(aNbLiterals, 15) << 4);
+  if (aNbLiterals >= 15)
+  {
+    aDst = writeLength(aDst, aNbLiterals - 15);
+  }
+  memcpy(aDst, theSrc + anAnchor, aNbLiterals);
+  aDst += aNbLiterals;
+  return (Standard_Size)(aDst - theDst);
+}
+
+//=================================================================================================
+
+Standard_Boolean BinLDrivers_ChunkedStreamBuffer::Decompress(const Standard_Byte* theSrc,
+                                                             const Standard_Size  theSrcSize,
+                                                             Standard_Byte*       theDst,
+                                                             const Standard_Size  theDstSize)
+{
+  const Standard_Byte* aSrc    = theSrc;
+  const Standard_Byte* aSrcEnd = theSrc + theSrcSize;
+  Standard_Byte*       aDst    = theDst;
+  while (aSrc < aSrcEnd)
+  {
+    const Standard_Byte aToken      = *aSrc++;
+    Standard_Size       aNbLiterals = aToken >> 4;
+    if (aNbLiterals == 15 && !readLength(aSrc, aSrcEnd, aNbLiterals))
+    {
+      return Standard_False;
+    }
+    if (aNbLiterals > (Standard_Size)(aSrcEnd - aSrc)
+        || aNbLiterals > theDstSize - (Standard_Size)(aDst - theDst))
+    {
+      return Standard_False;
+    }
+    memcpy(aDst, aSrc, aNbLiterals);
+    aSrc += aNbLiterals;
+    aDst += aNbLiterals;
+    if (aSrc == aSrcEnd)
+    {
+      // the last sequence has no match
+      break;
+    }
+
+    if (aSrcEnd - aSrc < 2)
+    {
+      return Standard_False;
+    }
+    const Standard_Size anOffset = (Standard_Size)aSrc[0] | ((Standard_Size)aSrc[1] << 8);
+    aSrc += 2;
+    if (anOffset == 0 || anOffset > (Standard_Size)(aDst - theDst))
+    {
+      return Standard_False;
+    }
+
+    Standard_Size aLength = aToken & 0x0F;
+    if (aLength == 15 && !readLength(aSrc, aSrcEnd, aLength))
+    {
+      return Standard_False;
+    }
+    aLength += THE_MIN_MATCH;
+    if (aLength > theDstSize - (Standard_Size)(aDst - theDst))
+    {
+      return Standard_False;
+    }
+
+    // the match may overlap the data being copied
+    const Standard_Byte* aRef = aDst - anOffset;
+    for (Standard_Size anIter = 0; anIter < aLength; ++anIter)
+    {
+      *aDst++ = *aRef++;
+    }
+  }
+  return (Standard_Size)(aDst - theDst) == theDstSize;
+}
+
+//=================================================================================================
+
+BinLDrivers_ChunkedStreamBuffer::BinLDrivers_ChunkedStreamBuffer()
+    : myStream(NULL),
+      myDataOffset(0),
+      myDataSize(0),
+      myChunkSize(0),
+      myCurrent(-1),
+      myToKeepAll(Standard_False),
+      myOStream(NULL),
+      myStartPos(0),
+      myNbPending(0),
+      myFlushed(0),
+      myFilled(0),
+      myToParallel(Standard_False),
+      myPatchPos(0),
+      myPatchStart(0),
+      myIsPatching(Standard_False),
+      myIsFailed(Standard_False)
+{
+  //
+}
+
+//=================================================================================================
+
+BinLDrivers_ChunkedStreamBuffer::~BinLDrivers_ChunkedStreamBuffer()
+{
+  //
+}
+
+//=================================================================================================
+
+Standard_Boolean BinLDrivers_ChunkedStreamBuffer::InitWrite(Standard_OStream&      theOStream,
+                                                            const uint64_t         theDataOffset,
+                                                            const Standard_Size    theChunkSize,
+                                                            const Standard_Boolean theToParallel)
+{
+  const Standard_Size aChunkSize = theChunkSize != 0 ? theChunkSize : THE_DEFAULT_CHUNK_SIZE;
+  myStartPos                     = (std::streamoff)theOStream.tellp();
+  if (aChunkSize > (Standard_Size)IntegerLast() || myStartPos < 0)
+  {
+    return Standard_False;
+  }
+
+  // the data size and the index offset are written by FinishWrite()
+  theOStream.write(THE_CHUNKS_MAGIC, sizeof(THE_CHUNKS_MAGIC));
+  writeUint32(theOStream, (uint32_t)aChunkSize);
+  writeUint64(theOStream, theDataOffset);
+  writeUint64(theOStream, 0);
+  writeUint64(theOStream, 0);
+  if (!theOStream.good())
+  {
+    return Standard_False;
+  }
+
+  const Standard_Integer aNbPending =
+    theToParallel ? Max(1, Min(Parallel1::NbLogicalProcessors(), THE_MAX_PENDING_CHUNKS)) : 1;
+  myPending.Resize(0, aNbPending - 1, Standard_False);
+  myPacked.Resize(0, aNbPending - 1, Standard_False);
+  myPackedSizes.Clear();
+  myChecksums.Clear();
+  myPatches.Clear();
+  myPatchData.clear();
+  myOStream    = &theOStream;
+  myDataOffset = theDataOffset;
+  myDataSize   = 0;
+  myChunkSize  = aChunkSize;
+  myToParallel = theToParallel;
+  myNbPending  = 0;
+  myFlushed    = 0;
+  myFilled     = 0;
+  myIsPatching = Standard_False;
+  myIsFailed   = Standard_False;
+  return nextChunk();
+}
+
+//=================================================================================================
+
+Standard_Boolean BinLDrivers_ChunkedStreamBuffer::FinishWrite()
+{
+  if (myOStream == NULL)
+  {
+    return Standard_False;
+  }
+
+  if (myIsPatching)
+  {
+    finishPatch();
+  }
+  else
+  {
+    myFilled = std::max(myFilled, (Standard_Size)(pptr() - pbase()));
+  }
+  setp(NULL, NULL);
+
+  Standard_Boolean isOk = !myIsFailed;
+  if (isOk && (myFilled != 0 || myNbPending != 0))
+  {
+    isOk = myFilled != 0 ? writePending(myNbPending + 1, myFilled)
+                         : writePending(myNbPending, myChunkSize);
+  }
+  myDataSize                     = myFlushed + myFilled;
+  const std::streamoff anIndexPos = (std::streamoff)myOStream->tellp();
+  if (isOk && anIndexPos >= myStartPos + THE_HEADER_SIZE
+      && myPatches.Length() < IntegerLast())
+  {
+    writeUint32(*myOStream, (uint32_t)myPackedSizes.Length());
+    for (Standard_Integer anIndex = 0; anIndex < myPackedSizes.Length(); ++anIndex)
+    {
+      writeUint32(*myOStream, myPackedSizes(anIndex));
+      writeUint32(*myOStream, myChecksums(anIndex));
+    }
+    writeUint32(*myOStream, (uint32_t)myPatches.Length());
+    for (NCollection_Vector<Patch>::Iterator aPatchIter(myPatches); aPatchIter.More();
+         aPatchIter.Next())
+    {
+      const Patch& aPatch = aPatchIter.Value();
+      writeUint64(*myOStream, aPatch.Position);
+      writeUint32(*myOStream, (uint32_t)aPatch.Size);
+      myOStream->write(myPatchData.data() + aPatch.Start, (std::streamsize)aPatch.Size);
+    }
+
+    // complete the header
+    const std::streamoff anEndPos = (std::streamoff)myOStream->tellp();
+    myOStream->seekp(myStartPos + THE_DATA_SIZE_POS, std::ios_base::beg);
+    writeUint64(*myOStream, myDataSize);
+    writeUint64(*myOStream, (uint64_t)(anIndexPos - myStartPos));
+    myOStream->seekp(anEndPos, std::ios_base::beg);
+    isOk = myOStream->good();
+  }
+  else
+  {
+    isOk = Standard_False;
+  }
+
+  for (Standard_Integer anIndex = myPending.Lower(); anIndex <= myPending.Upper(); ++anIndex)
+  {
+    myPending(anIndex).Nullify();
+    myPacked(anIndex).Nullify();
+  }
+  myPatches.Clear();
+  myPatchData.clear();
+  myOStream = NULL;
+  return isOk;
+}
+
+//=================================================================================================
+
+Standard_Boolean BinLDrivers_ChunkedStreamBuffer::writePending(const Standard_Integer theNbChunks,
+                                                               const Standard_Size theLastSize)
+{
+  if (myPackedSizes.Length() > IntegerLast() - theNbChunks)
+  {
+    return Standard_False;
+  }
+
+  // compress chunks independently, chunks that do not compress are stored as is
+  NCollection_Array1<Standard_Size> aPackedSizes(0, theNbChunks - 1);
+  NCollection_Array1<uint32_t>      aChecksums(0, theNbChunks - 1);
+  Parallel1::For(
+    0,
+    theNbChunks,
+    [&](const Standard_Integer theIndex) {
+      const Standard_Size aSize = theIndex == theNbChunks - 1 ? theLastSize : myChunkSize;
+      if (myPacked(theIndex).IsNull())
+      {
+        myPacked(theIndex) =
+          new NCollection_Buffer(NCollection_BaseAllocator::CommonBaseAllocator(),
+                                 CompressBound(myChunkSize));
+      }
+      const Standard_Size aPackedSize = Compress(myPending(theIndex)->Data(),
+                                                 aSize,
+                                                 myPacked(theIndex)->ChangeData(),
+                                                 myPacked(theIndex)->Size());
+      const Standard_Boolean isPacked = aPackedSize != 0 && aPackedSize < aSize;
+      aPackedSizes(theIndex)          = isPacked ? aPackedSize : aSize;
+      aChecksums(theIndex) =
+        checksum(isPacked ? myPacked(theIndex)->Data() : myPending(theIndex)->Data(),
+                 aPackedSizes(theIndex));
+    },
+    !myToParallel);
+
+  for (Standard_Integer anIndex = 0; anIndex < theNbChunks; ++anIndex)
+  {
+    const Standard_Size  aSize  = anIndex == theNbChunks - 1 ? theLastSize : myChunkSize;
+    const Standard_Byte* aChunk = aPackedSizes(anIndex) < aSize ? myPacked(anIndex)->Data()
+                                                                 : myPending(anIndex)->Data();
+    myOStream->write((const char*)aChunk, (std::streamsize)aPackedSizes(anIndex));
+    myPackedSizes.Append((uint32_t)aPackedSizes(anIndex));
+    myChecksums.Append(aChecksums(anIndex));
+  }
+  myNbPending = 0;
+  return myOStream->good();
+}
+
+//=================================================================================================
+
+Standard_Boolean BinLDrivers_ChunkedStreamBuffer::nextChunk()
+{
+  Handle(NCollection_Buffer)& aChunk = myPending(myNbPending);
+  if (aChunk.IsNull())
+  {
+    aChunk = new NCollection_Buffer(NCollection_BaseAllocator::CommonBaseAllocator(), myChunkSize);
+    if (aChunk->Size() != myChunkSize)
+    {
+      aChunk.Nullify();
+      myIsFailed = Standard_True;
+      return Standard_False;
+    }
+  }
+  char* aBegin = (char*)aChunk->ChangeData();
+  setp(aBegin, aBegin + myChunkSize);
+  return Standard_True;
+}
+
+//=================================================================================================
+
+void BinLDrivers_ChunkedStreamBuffer::flushPatch()
+{
+  myPatchData.append(pbase(), (size_t)(pptr() - pbase()));
+  setp(myPatchBuffer, myPatchBuffer + sizeof(myPatchBuffer));
+}
+
+//=================================================================================================
+
+Standard_Boolean BinLDrivers_ChunkedStreamBuffer::finishPatch()
+{
+  flushPatch();
+  myIsPatching = Standard_False;
+
+  // the part of patch following the filled chunks is written to the current chunk
+  const Standard_Size aSize = myPatchData.size() - myPatchStart;
+  const Standard_Size aHead = (Standard_Size)std::min<uint64_t>(aSize, myFlushed - myPatchPos);
+  const Standard_Size aTail = aSize - aHead;
+  if (aHead > myChunkSize || aTail > myChunkSize)
+  {
+    myIsFailed = Standard_True;
+    return Standard_False;
+  }
+  if (aHead != 0)
+  {
+    Patch aPatch;
+    aPatch.Position = myPatchPos;
+    aPatch.Size     = aHead;
+    aPatch.Start    = myPatchStart;
+    myPatches.Append(aPatch);
+  }
+  if (aTail != 0)
+  {
+    memcpy(myPending(myNbPending)->ChangeData(), myPatchData.data() + myPatchStart + aHead, aTail);
+    myFilled = std::max(myFilled, aTail);
+    myPatchData.resize(myPatchStart + aHead);
+  }
+  return Standard_True;
+}
+
+//=================================================================================================
+
+BinLDrivers_ChunkedStreamBuffer::int_type BinLDrivers_ChunkedStreamBuffer::overflow(
+  int_type theChar)
+{
+  if (myOStream == NULL || myIsFailed)
+  {
+    return traits_type::eof();
+  }
+
+  if (myIsPatching)
+  {
+    flushPatch();
+  }
+  else if (pptr() >= epptr())
+  {
+    // the current chunk is filled, it is written with the other pending ones
+    myFlushed += myChunkSize;
+    myFilled = 0;
+    if ((++myNbPending == myPending.Size() && !writePending(myNbPending, myChunkSize))
+        || !nextChunk())
+    {
+      myIsFailed = Standard_True;
+      return traits_type::eof();
+    }
+  }
+
+  if (!traits_type::eq_int_type(theChar, traits_type::eof()))
+  {
+    *pptr() = traits_type::to_char_type(theChar);
+    pbump(1);
+  }
+  return traits_type::not_eof(theChar);
+}
+
+//=================================================================================================
+
+BinLDrivers_ChunkedStreamBuffer::pos_type BinLDrivers_ChunkedStreamBuffer::seekWrite(
+  const off_type               theOff,
+  const std::ios_base::seekdir theWay)
+{
+  const uint64_t aCurrent = writePosition();
+  if (theWay == std::ios_base::cur && theOff == 0)
+  {
+    return pos_type((off_type)aCurrent);
+  }
+
+  if (myIsPatching)
+  {
+    if (!finishPatch())
+    {
+      return pos_type(off_type(-1));
+    }
+  }
+  else
+  {
+    myFilled = std::max(myFilled, (Standard_Size)(pptr() - pbase()));
+  }
+
+  const uint64_t anEnd = myDataOffset + myFlushed + myFilled;
+  off_type       aPosition;
+  switch (theWay)
+  {
+    case std::ios_base::beg:
+      aPosition = theOff;
+      break;
+    case std::ios_base::cur:
+      aPosition = (off_type)aCurrent + theOff;
+      break;
+    case std::ios_base::end:
+      aPosition = (off_type)anEnd + theOff;
+      break;
+    default:
+      aPosition = -1;
+      break;
+  }
+
+  // the position is kept if the new one is out of the written data
+  const Standard_Boolean isValid =
+    aPosition >= (off_type)myDataOffset && aPosition <= (off_type)anEnd;
+  const uint64_t aDataPos = (isValid ? (uint64_t)aPosition : aCurrent) - myDataOffset;
+  if (aDataPos >= myFlushed)
+  {
+    char* aBegin = (char*)myPending(myNbPending)->ChangeData();
+    setp(aBegin, aBegin + myChunkSize);
+    pbump((int)(aDataPos - myFlushed));
+  }
+  else
+  {
+    // data of the filled chunks is changed by the patch applied on reading
+    myIsPatching = Standard_True;
+    myPatchPos   = aDataPos;
+    myPatchStart = myPatchData.size();
+    setp(myPatchBuffer, myPatchBuffer + sizeof(myPatchBuffer));
+  }
+  return isValid ? pos_type(aPosition) : pos_type(off_type(-1));
+}
+
+//=================================================================================================
+
+Standard_Boolean BinLDrivers_ChunkedStreamBuffer::Init(Standard_IStream& theIStream)
+{
+  const std::streamoff aStartPos = (std::streamoff)theIStream.tellg();
+  char                 aMagic[sizeof(THE_CHUNKS_MAGIC)];
+  uint32_t             aChunkSize = 0, aNbChunks = 0, aNbPatches = 0;
+  uint64_t             anIndexOffset = 0;
+  theIStream.read(aMagic, sizeof(aMagic));
+  if (aStartPos < 0 || theIStream.gcount() != sizeof(aMagic)
+      || memcmp(aMagic, THE_CHUNKS_MAGIC, sizeof(THE_CHUNKS_MAGIC)) != 0
+      || !readUint32(theIStream, aChunkSize) || !readUint64(theIStream, myDataOffset)
+      || !readUint64(theIStream, myDataSize) || !readUint64(theIStream, anIndexOffset))
+  {
+    return Standard_False;
+  }
+  const uint64_t aNbExpected = aChunkSize != 0 ? (myDataSize + aChunkSize - 1) / aChunkSize : 0;
+  if ((aChunkSize == 0 && myDataSize != 0) || aNbExpected > (uint64_t)IntegerLast()
+      || anIndexOffset < (uint64_t)THE_HEADER_SIZE
+      || anIndexOffset > (uint64_t)std::numeric_limits<std::streamoff>::max() - aStartPos)
+  {
+    return Standard_False;
+  }
+
+  // the index follows the chunks, its absence means that the container is truncated
+  theIStream.seekg(aStartPos + (std::streamoff)anIndexOffset, std::ios_base::beg);
+  if (!readUint32(theIStream, aNbChunks) || aNbChunks != aNbExpected)
+  {
+    return Standard_False;
+  }
+
+  myChunkSize                         = aChunkSize;
+  const Standard_Integer aNbChunksInt = (Standard_Integer)aNbChunks;
+  myChunkOffsets.Resize(0, aNbChunksInt, Standard_False);
+  myChunkOffsets(0) = (uint64_t)(aStartPos + THE_HEADER_SIZE);
+  myChecksums.Clear();
+  for (Standard_Integer anIndex = 0; anIndex < aNbChunksInt; ++anIndex)
+  {
+    uint32_t aPackedSize = 0, aChecksum = 0;
+    if (!readUint32(theIStream, aPackedSize) || !readUint32(theIStream, aChecksum)
+        || aPackedSize > chunkSize(anIndex) || aPackedSize == 0)
+    {
+      return Standard_False;
+    }
+    myChunkOffsets(anIndex + 1) = myChunkOffsets(anIndex) + aPackedSize;
+    myChecksums.Append(aChecksum);
+  }
+  if (myChunkOffsets(aNbChunksInt) != (uint64_t)aStartPos + anIndexOffset)
+  {
+    return Standard_False;
+  }
+
+  // patches are distributed by chunks they change
+  if (!readUint32(theIStream, aNbPatches) || aNbPatches > (uint32_t)IntegerLast())
+  {
+    return Standard_False;
+  }
+  myPatches.Clear();
+  myPatchData.clear();
+  myChunkPatches.Resize(0, aNbChunksInt, Standard_False);
+  myChunkPatches.Init(0);
+  for (uint32_t aPatchIter = 0; aPatchIter < aNbPatches; ++aPatchIter)
+  {
+    uint64_t aPosition = 0;
+    uint32_t aSize     = 0;
+    if (!readUint64(theIStream, aPosition) || !readUint32(theIStream, aSize) || aSize == 0
+        || aSize > myChunkSize || aPosition > myDataSize || aSize > myDataSize - aPosition)
+    {
+      return Standard_False;
+    }
+    Patch aPatch;
+    aPatch.Position = aPosition;
+    aPatch.Size     = aSize;
+    aPatch.Start    = myPatchData.size();
+    myPatchData.resize(aPatch.Start + aSize);
+    theIStream.read(&myPatchData[aPatch.Start], (std::streamsize)aSize);
+    if (theIStream.gcount() != (std::streamsize)aSize)
+    {
+      return Standard_False;
+    }
+    myPatches.Append(aPatch);
+    for (uint64_t aChunk = aPosition / myChunkSize; aChunk <= (aPosition + aSize - 1) / myChunkSize;
+         ++aChunk)
+    {
+      ++myChunkPatches((Standard_Integer)aChunk + 1);
+    }
+  }
+  for (Standard_Integer anIndex = 1; anIndex <= aNbChunksInt; ++anIndex)
+  {
+    myChunkPatches(anIndex) += myChunkPatches(anIndex - 1);
+  }
+  NCollection_Array1<Standard_Integer> aNext(0, aNbChunksInt);
+  aNext.Assign(myChunkPatches);
+  myPatchIndices.Resize(0, Max(myChunkPatches(aNbChunksInt), 1) - 1, Standard_False);
+  for (Standard_Integer aPatchIndex = 0; aPatchIndex < myPatches.Length(); ++aPatchIndex)
+  {
+    const Patch& aPatch = myPatches(aPatchIndex);
+    for (uint64_t aChunk = aPatch.Position / myChunkSize;
+         aChunk <= (aPatch.Position + aPatch.Size - 1) / myChunkSize;
+         ++aChunk)
+    {
+      myPatchIndices(aNext((Standard_Integer)aChunk)++) = aPatchIndex;
+    }
+  }
+
+  if (aNbChunksInt != 0)
+  {
+    myChunks.Resize(0, aNbChunksInt - 1, Standard_False);
+  }
+  myStream    = &theIStream;
+  myCurrent   = -1;
+  myToKeepAll = Standard_False;
+  setg(NULL, NULL, NULL);
+  return Standard_True;
+}
+
+//=================================================================================================
+
+Standard_Boolean BinLDrivers_ChunkedStreamBuffer::DecompressAll(
+  const Standard_Boolean theToParallel)
+{
+  if (myChunks.IsEmpty())
+  {
+    myToKeepAll = Standard_True;
+    return Standard_True;
+  }
+
+  // read all chunks at once, then decompress them independently
+  const Standard_Size aPackedSize = (Standard_Size)(myChunkOffsets.Last() - myChunkOffsets.First());
+  Handle(NCollection_Buffer) aPacked =
+    new NCollection_Buffer(NCollection_BaseAllocator::CommonBaseAllocator(), aPackedSize);
+  if (aPacked->Size() != aPackedSize)
+  {
+    return Standard_False;
+  }
+  myStream->clear();
+  myStream->seekg((std::streamoff)myChunkOffsets.First(), std::ios_base::beg);
+  myStream->read((char*)aPacked->ChangeData(), (std::streamsize)aPackedSize);
+  if ((Standard_Size)myStream->gcount() != aPackedSize)
+  {
+    return Standard_False;
+  }
+
+  Parallel1::For(
+    0,
+    myChunks.Size(),
+    [&](const Standard_Integer theIndex) {
+      if (myChunks(theIndex).IsNull())
+      {
+        myChunks(theIndex) =
+          decodeChunk(theIndex,
+                      aPacked->Data() + (myChunkOffsets(theIndex) - myChunkOffsets.First()));
+      }
+    },
+    !theToParallel);
+
+  for (Standard_Integer anIndex = 0; anIndex < myChunks.Size(); ++anIndex)
+  {
+    if (myChunks(anIndex).IsNull())
+    {
+      return Standard_False;
+    }
+  }
+  myToKeepAll = Standard_True;
+  return Standard_True;
+}
+
+//=================================================================================================
+
+Handle(NCollection_Buffer) BinLDrivers_ChunkedStreamBuffer::decodeChunk(
+  const Standard_Integer theIndex,
+  const Standard_Byte*   thePacked) const
+{
+  const Standard_Size aSize = chunkSize(theIndex);
+  const Standard_Size aPackedSize =
+    (Standard_Size)(myChunkOffsets(theIndex + 1) - myChunkOffsets(theIndex));
+  Handle(NCollection_Buffer) aChunk =
+    new NCollection_Buffer(NCollection_BaseAllocator::CommonBaseAllocator(), aSize);
+  if (aChunk->Size() != aSize)
+  {
+    return Handle(NCollection_Buffer)();
+  }
+  if (checksum(thePacked, aPackedSize) != myChecksums(theIndex))
+  {
+    return Handle(NCollection_Buffer)();
+  }
+  if (aPackedSize == aSize)
+  {
+    memcpy(aChunk->ChangeData(), thePacked, aSize);
+  }
+  else if (!Decompress(thePacked, aPackedSize, aChunk->ChangeData(), aSize))
+  {
+    return Handle(NCollection_Buffer)();
+  }
+
+  // apply the data written after compression of the chunk
+  const uint64_t aStart = (uint64_t)theIndex * myChunkSize;
+  for (Standard_Integer aPatchIter = myChunkPatches(theIndex);
+       aPatchIter < myChunkPatches(theIndex + 1);
+       ++aPatchIter)
+  {
+    const Patch&   aPatch = myPatches(myPatchIndices(aPatchIter));
+    const uint64_t aFrom  = std::max(aPatch.Position, aStart);
+    const uint64_t aTo    = std::min(aPatch.Position + aPatch.Size, aStart + aSize);
+    memcpy(aChunk->ChangeData() + (aFrom - aStart),
+           myPatchData.data() + aPatch.Start + (aFrom - aPatch.Position),
+           (Standard_Size)(aTo - aFrom));
+  }
+  return aChunk;
+}
+
+//=================================================================================================
+
+Standard_Boolean BinLDrivers_ChunkedStreamBuffer::setChunk(const Standard_Integer theIndex,
+                                                           const Standard_Size    theOffset)
+{
+  if (myChunks(theIndex).IsNull())
+  {
+    const Standard_Size aPackedSize =
+      (Standard_Size)(myChunkOffsets(theIndex + 1) - myChunkOffsets(theIndex));
+    Handle(NCollection_Buffer) aPacked =
+      new NCollection_Buffer(NCollection_BaseAllocator::CommonBaseAllocator(), aPackedSize);
+    myStream->clear();
+    myStream->seekg((std::streamoff)myChunkOffsets(theIndex), std::ios_base::beg);
+    myStream->read((char*)aPacked->ChangeData(), (std::streamsize)aPackedSize);
+    if ((Standard_Size)myStream->gcount() != aPackedSize)
+    {
+      return Standard_False;
+    }
+    myChunks(theIndex) = decodeChunk(theIndex, aPacked->Data());
+    if (myChunks(theIndex).IsNull())
+    {
+      return Standard_False;
+    }
+  }
+
+  // only the current chunk is kept in memory when reading on demand
+  if (!myToKeepAll && myCurrent >= 0 && myCurrent != theIndex)
+  {
+    myChunks(myCurrent).Nullify();
+  }
+  myCurrent    = theIndex;
+  char* aBegin = (char*)myChunks(theIndex)->ChangeData();
+  setg(aBegin, aBegin + theOffset, aBegin + myChunks(theIndex)->Size());
+  return Standard_True;
+}
+
+//=================================================================================================
+
+BinLDrivers_ChunkedStreamBuffer::int_type BinLDrivers_ChunkedStreamBuffer::underflow()
+{
+  if (gptr() < egptr())
+  {
+    return traits_type::to_int_type(*gptr());
+  }
+  if (myCurrent + 1 >= myChunks.Size() || !setChunk(myCurrent + 1, 0))
+  {
+    return traits_type::eof();
+  }
+  return traits_type::to_int_type(*gptr());
+}
+
+//=================================================================================================
+
+std::streamsize BinLDrivers_ChunkedStreamBuffer::showmanyc()
+{
+  const uint64_t aPosition = currentPosition();
+  const uint64_t anEnd     = myDataOffset + myDataSize;
+  return aPosition < anEnd ? (std::streamsize)(anEnd - aPosition) : -1;
+}
+
+//=================================================================================================
+
+BinLDrivers_ChunkedStreamBuffer::pos_type BinLDrivers_ChunkedStreamBuffer::seekoff(
+  off_type                theOff,
+  std::ios_base::seekdir  theWay,
+  std::ios_base::openmode theWhich)
+{
+  if ((theWhich & std::ios_base::out) != 0 && myOStream != NULL)
+  {
+    return seekWrite(theOff, theWay);
+  }
+  if ((theWhich & std::ios_base::in) == 0)
+  {
+    return pos_type(off_type(-1));
+  }
+
+  const uint64_t aCurrent = currentPosition();
+  off_type       aPosition;
+  switch (theWay)
+  {
+    case std::ios_base::beg:
+      aPosition = theOff;
+      break;
+    case std::ios_base::cur:
+      if (theOff == 0)
+      {
+        return pos_type((off_type)aCurrent);
+      }
+      aPosition = (off_type)aCurrent + theOff;
+      break;
+    case std::ios_base::end:
+      aPosition = (off_type)(myDataOffset + myDataSize) + theOff;
+      break;
+    default:
+      return pos_type(off_type(-1));
+  }
+
+  // the information section preceding the data cannot be read through this buffer
+  if (aPosition < (off_type)myDataOffset || aPosition > (off_type)(myDataOffset + myDataSize))
+  {
+    return pos_type(off_type(-1));
+  }
+  if (myChunks.IsEmpty())
+  {
+    return pos_type(aPosition);
+  }
+
+  const uint64_t         aDataPos = (uint64_t)aPosition - myDataOffset;
+  const Standard_Integer anIndex =
+    (Standard_Integer)std::min<uint64_t>(aDataPos / myChunkSize, myChunks.Size() - 1);
+  if (!setChunk(anIndex, (Standard_Size)(aDataPos - (uint64_t)anIndex * myChunkSize)))
+  {
+    return pos_type(off_type(-1));
+  }
+  return pos_type(aPosition);
+}
+
+//=================================================================================================
+
+BinLDrivers_ChunkedStreamBuffer::pos_type BinLDrivers_ChunkedStreamBuffer::seekpos(
+  pos_type                thePosition,
+  std::ios_base::openmode theWhich)
+{
+  return seekoff(off_type(thePosition), std::ios_base::beg, theWhich);
+}
@@ -0,0 +1,246 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BinLDrivers_ChunkedStreamBuffer_HeaderFile
+#define _BinLDrivers_ChunkedStreamBuffer_HeaderFile
+
+#include <NCollection_Array1.hxx>
+#include <NCollection_Buffer.hxx>
+#include <NCollection_Vector.hxx>
+#include <Standard_Stream.hxx>
+
+#include <algorithm>
+#include <stdint.h>
+#include <string>
+
+//! Chunked storage of the data part of a binary OCAF document (format version 13+).
+//!
+//! The document data following the information section is split into chunks of fixed size,
+//! each chunk is compressed independently by a fast LZ77 codec (LZ4 block layout).
+//! The container is written in a single pass, so the index of chunks follows the chunks:
+//! @code
+//!   char[8]  magic "OCAFCHNK"
+//!   uint32   size of uncompressed chunk
+//!   uint64   offset of the data in the document
+//!   uint64   size of uncompressed data
+//!   uint64   offset of the index from the beginning of the container
+//!   ...      chunks
+//!   uint32   number of chunks
+//!   uint32[] size and Adler-32 checksum of each compressed chunk
+//!            (size is equal to uncompressed size for stored chunks)
+//!   uint32   number of patches
+//!   ...      patches: uint64 position in the data, uint32 size and bytes
+//! @endcode
+//! The patches keep the data written by the document writer back into the chunks that were
+//! already compressed (sizes of labels and attributes, table of contents of sections);
+//! they are applied to the chunks on decompression.
+//!
+//! Positions in the stream written or read through this buffer are positions in the
+//! uncompressed document, so the offsets of sections stored in the document remain valid.
+//! On writing, at most THE_MAX_PENDING_CHUNKS filled chunks are kept in memory before being
+//! compressed in parallel and written. On reading, chunks are decompressed on demand when
+//! the reader seeks to them, or all at once in parallel by DecompressAll().
+//!
+//! The underlying stream is NOT managed by this class - it is up to the caller to ensure that
+//! it is alive during the BinLDrivers_ChunkedStreamBuffer lifetime.
+class BinLDrivers_ChunkedStreamBuffer : public std::streambuf
+{
+public:
+  //! Default size of uncompressed chunk.
+  static const Standard_Size THE_DEFAULT_CHUNK_SIZE = 1024 * 1024;
+
+  //! Maximum number of filled chunks kept in memory before compression on writing.
+  static const Standard_Integer THE_MAX_PENDING_CHUNKS = 8;
+
+  //! Returns the maximum size of compressed data for the input of specified size.
+  static Standard_Size CompressBound(const Standard_Size theSize)
+  {
+    return theSize + theSize / 255 + 16;
+  }
+
+  //! Compresses the block of data.
+  //! @return size of compressed data or 0 if it does not fit into theDstCapacity
+  Standard_EXPORT static Standard_Size Compress(const Standard_Byte* theSrc,
+                                                const Standard_Size  theSrcSize,
+                                                Standard_Byte*       theDst,
+                                                const Standard_Size  theDstCapacity);
+
+  //! Decompresses the block of data, which should expand exactly to theDstSize bytes.
+  Standard_EXPORT static Standard_Boolean Decompress(const Standard_Byte* theSrc,
+                                                     const Standard_Size  theSrcSize,
+                                                     Standard_Byte*       theDst,
+                                                     const Standard_Size  theDstSize);
+
+public:
+  //! Empty constructor.
+  Standard_EXPORT BinLDrivers_ChunkedStreamBuffer();
+
+  //! Destructor.
+  Standard_EXPORT virtual ~BinLDrivers_ChunkedStreamBuffer();
+
+  //! Starts writing of the container at the current position of theOStream.
+  //! The data written through this buffer afterwards is compressed by chunks.
+  //! @param theOStream    output stream, should support seeking back to the container header
+  //! @param theDataOffset position of the data in the document
+  //! @param theChunkSize  size of uncompressed chunk
+  //! @param theToParallel compress chunks in parallel threads
+  //! @return false if the chunk size is out of range
+  Standard_EXPORT Standard_Boolean InitWrite(Standard_OStream&      theOStream,
+                                             const uint64_t         theDataOffset,
+                                             const Standard_Size    theChunkSize,
+                                             const Standard_Boolean theToParallel);
+
+  //! Writes the rest of data, the index of chunks and completes the container header.
+  //! @return false if writing has failed
+  Standard_EXPORT Standard_Boolean FinishWrite();
+
+  //! Reads the index of chunks of the container starting at the current position of theIStream.
+  //! The stream is kept for reading of chunks on demand.
+  //! @return false if the index is corrupted
+  Standard_EXPORT Standard_Boolean Init(Standard_IStream& theIStream);
+
+  //! Decompresses all chunks at once and keeps them in memory.
+  //! @return false if any chunk is corrupted
+  Standard_EXPORT Standard_Boolean DecompressAll(const Standard_Boolean theToParallel);
+
+  //! Returns position of the data in the document.
+  uint64_t DataOffset() const { return myDataOffset; }
+
+  //! Returns size of the uncompressed data.
+  uint64_t DataSize() const { return myDataSize; }
+
+  //! Returns number of chunks.
+  Standard_Integer NbChunks() const { return myChunks.Size(); }
+
+protected:
+  //! Put character on overflow.
+  //! Compresses the current chunk when it is filled.
+  Standard_EXPORT virtual int_type overflow(int_type theChar) Standard_OVERRIDE;
+
+  //! Get character on underflow.
+  //! Decompresses the next chunk when the current one is exhausted.
+  Standard_EXPORT virtual int_type underflow() Standard_OVERRIDE;
+
+  //! Get number of characters available in the current chunk.
+  Standard_EXPORT virtual std::streamsize showmanyc() Standard_OVERRIDE;
+
+  //! Seek to specified position of the uncompressed document.
+  //! On writing, positions within compressed chunks are recorded as patches.
+  Standard_EXPORT virtual pos_type seekoff(off_type                theOff,
+                                           std::ios_base::seekdir  theWay,
+                                           std::ios_base::openmode theWhich) Standard_OVERRIDE;
+
+  //! Change to specified position of the uncompressed document.
+  Standard_EXPORT virtual pos_type seekpos(pos_type                thePosition,
+                                           std::ios_base::openmode theWhich) Standard_OVERRIDE;
+
+private:
+  //! Makes the chunk current, reading and decompressing it if needed.
+  //! @param theIndex  index of the chunk
+  //! @param theOffset position within the chunk
+  Standard_Boolean setChunk(const Standard_Integer theIndex, const Standard_Size theOffset);
+
+  //! Decompresses the chunk from the buffer.
+  Handle(NCollection_Buffer) decodeChunk(const Standard_Integer theIndex,
+                                         const Standard_Byte*   thePacked) const;
+
+  //! Seek to specified position on writing.
+  pos_type seekWrite(const off_type theOff, const std::ios_base::seekdir theWay);
+
+  //! Compresses and writes the pending chunks.
+  //! @param theNbChunks number of pending chunks to write
+  //! @param theLastSize uncompressed size of the last chunk
+  Standard_Boolean writePending(const Standard_Integer theNbChunks,
+                                const Standard_Size    theLastSize);
+
+  //! Makes the next pending chunk current on writing.
+  Standard_Boolean nextChunk();
+
+  //! Moves the written part of the patch buffer to the patch data.
+  void flushPatch();
+
+  //! Completes the current patch.
+  Standard_Boolean finishPatch();
+
+  //! Returns the current position in the document on writing.
+  uint64_t writePosition() const
+  {
+    return myDataOffset
+           + (myIsPatching ? myPatchPos + (uint64_t)(myPatchData.size() - myPatchStart)
+                           : myFlushed)
+           + (uint64_t)(pptr() - pbase());
+  }
+
+  //! Returns the uncompressed size of the chunk.
+  Standard_Size chunkSize(const Standard_Integer theIndex) const
+  {
+    const uint64_t aStart = (uint64_t)theIndex * myChunkSize;
+    return (Standard_Size)std::min<uint64_t>(myDataSize - aStart, myChunkSize);
+  }
+
+  //! Returns the current position in the document.
+  uint64_t currentPosition() const
+  {
+    return myCurrent < 0
+             ? myDataOffset
+             : myDataOffset + (uint64_t)myCurrent * myChunkSize + (uint64_t)(gptr() - eback());
+  }
+
+private:
+  // copying is not allowed
+  BinLDrivers_ChunkedStreamBuffer(const BinLDrivers_ChunkedStreamBuffer&);
+  BinLDrivers_ChunkedStreamBuffer& operator=(const BinLDrivers_ChunkedStreamBuffer&);
+
+private:
+  //! Data written to the position of already compressed chunks.
+  struct Patch
+  {
+    uint64_t      Position; //!< position in the data
+    Standard_Size Size;     //!< number of bytes
+    Standard_Size Start;    //!< position of the bytes in the patch data
+  };
+
+private:
+  Standard_IStream*                              myStream;       //!< stream of compressed chunks
+  NCollection_Array1<uint64_t>                   myChunkOffsets; //!< stream positions of chunks
+  NCollection_Array1<Handle(NCollection_Buffer)> myChunks;       //!< decompressed chunks
+  uint64_t                                       myDataOffset;   //!< position of data in document
+  uint64_t                                       myDataSize;     //!< size of uncompressed data
+  Standard_Size                                  myChunkSize;    //!< size of uncompressed chunk
+  Standard_Integer                               myCurrent;      //!< index of current chunk
+  Standard_Boolean                               myToKeepAll;    //!< keep decompressed chunks
+  NCollection_Array1<Standard_Integer>           myChunkPatches; //!< first patch index of chunks
+  NCollection_Array1<Standard_Integer>           myPatchIndices; //!< patches sorted by chunks
+
+  Standard_OStream*                              myOStream;      //!< stream of written container
+  std::streamoff                                 myStartPos;     //!< position of the container
+  NCollection_Array1<Handle(NCollection_Buffer)> myPending;      //!< filled chunks to write
+  NCollection_Array1<Handle(NCollection_Buffer)> myPacked;       //!< compressed pending chunks
+  NCollection_Vector<uint32_t>                   myPackedSizes;  //!< sizes of written chunks
+  NCollection_Vector<uint32_t>                   myChecksums;    //!< checksums of compressed chunks
+  Standard_Integer                               myNbPending;    //!< number of filled chunks
+  uint64_t                                       myFlushed;      //!< size of data in filled chunks
+  Standard_Size                                  myFilled;       //!< size of data in current chunk
+  Standard_Boolean                               myToParallel;   //!< compress in parallel
+
+  NCollection_Vector<Patch>                      myPatches;      //!< patches of chunks
+  std::string                                    myPatchData;    //!< bytes of patches
+  uint64_t                                       myPatchPos;     //!< position of current patch
+  Standard_Size                                  myPatchStart;   //!< start of current patch bytes
+  Standard_Boolean                               myIsPatching;   //!< current patch is written
+  Standard_Boolean                               myIsFailed;     //!< writing has failed
+
+  char myPatchBuffer[64]; //!< put area of patches
+};
+
+#endif // _BinLDrivers_ChunkedStreamBuffer_HeaderFile
@@ -14,6 +14,7 @@
 // commercial license or contractual agreement.
 
 #include <BinLDrivers.hxx>
+#include <BinLDrivers_ChunkedStreamBuffer.hxx>
 #include <BinLDrivers_DocumentRetrievalDriver.hxx>
 #include <BinLDrivers_DocumentSection.hxx>
 #include <BinLDrivers_Marker.hxx>
@@ -54,6 +55,7 @@ IMPLEMENT_STANDARD_RTTIEXT(BinLDrivers_DocumentRetrievalDriver, PCDM_RetrievalDr
 //=================================================================================================
 
 BinLDrivers_DocumentRetrievalDriver::BinLDrivers_DocumentRetrievalDriver()
+    : myIsChunked(Standard_False)
 {
   myReaderStatus = PCDM_RS_OK;
 }
@@ -199,7 +201,11 @@ void BinLDrivers_DocumentRetrievalDriver::Read(Standard_IStream&
     }
   }
   if (myDrivers.IsNull())
-    myDrivers = AttributeDrivers(myMsgDriver);
+  {
+    Handle(AttributeDriverTable) aDrivers = AttributeDrivers(myMsgDriver);
+    Standard_Mutex::Sentry       aLock(myDriversMutex);
+    myDrivers = aDrivers;
+  }
   myDrivers->AssignIds(aTypeNames);
 
   // recognize types not supported by drivers
@@ -218,6 +224,25 @@ void BinLDrivers_DocumentRetrievalDriver::Read(Standard_IStream&
         myMsgDriver->Send(aTypeNames(i), Message_Warning);
   }
 
+  // 1.c Data of documents since version 13 may be stored by compressed chunks: the rest of the
+  // document is read through the buffer decompressing chunks, all in parallel for the whole
+  // document or on demand for partial reading
+  BinLDrivers_ChunkedStreamBuffer aChunkedBuffer;
+  Standard_IStream                aChunkedStream(&aChunkedBuffer);
+  myIsChunked = aFileVer >= TDocStd_FormatVersion_VERSION_13;
+  if (myIsChunked)
+  {
+    const Standard_Boolean isPartial = !theFilter.IsNull() && theFilter->IsPartTree();
+    if (!aChunkedBuffer.Init(theIStream)
+        || (!isPartial && !aChunkedBuffer.DecompressAll(Standard_True)))
+    {
+      myMsgDriver->Send(aMethStr + "error: corrupted compressed data", Message_Fail);
+      myReaderStatus = PCDM_RS_FormatFailure;
+      return;
+    }
+  }
+  Standard_IStream& anIS = myIsChunked ? aChunkedStream : theIStream;
+
   // 2. Read document contents
   // 2a. Retrieve data from the stream:
   myRelocTable.Clear();
@@ -236,13 +261,13 @@ void BinLDrivers_DocumentRetrievalDriver::Read(Standard_IStream&
     DocumentSection aSection;
     do
     {
-      if (!DocumentSection::ReadTOC(aSection, theIStream, aFileVer))
+      if (!DocumentSection::ReadTOC(aSection, anIS, aFileVer))
         break;
       mySections.Append(aSection);
     } while (!aSection.Name().IsEqual(aQuickPart ? ENDSECTION_POS : SHAPESECTION_POS)
-             && !theIStream.eof());
+             && !anIS.eof());
 
-    if (mySections.IsEmpty() || theIStream.eof())
+    if (mySections.IsEmpty() || anIS.eof())
     {
       // There is no shape section in the file.
       myMsgDriver->Send(aMethStr + "error: shape section is not found", Message_Fail);
@@ -255,16 +280,16 @@ void BinLDrivers_DocumentRetrievalDriver::Read(Standard_IStream&
     if (!mySections.IsEmpty()
         && (mySections.Size() > 1 || !anIterS.Value().Name().IsEqual(ENDSECTION_POS)))
     {
-      std::streampos aDocumentPos = theIStream.tellg(); // position of root label
+      std::streampos aDocumentPos = anIS.tellg(); // position of root label
       for (; anIterS.More(); anIterS.Next())
       {
         DocumentSection& aCurSection = anIterS.ChangeValue();
         if (aCurSection.IsPostRead() == Standard_False)
         {
-          theIStream.seekg((std::streampos)aCurSection.Offset());
+          anIS.seekg((std::streampos)aCurSection.Offset());
           if (aCurSection.Name().IsEqual(SHAPESECTION_POS))
           {
-            ReadShapeSection(aCurSection, theIStream, false, aPS.Next());
+            ReadShapeSection(aCurSection, anIS, false, aPS.Next());
             if (!aPS.More())
             {
               myReaderStatus = PCDM_RS_UserBreak;
@@ -272,19 +297,19 @@ void BinLDrivers_DocumentRetrievalDriver::Read(Standard_IStream&
             }
           }
           else if (!aCurSection.Name().IsEqual(ENDSECTION_POS))
-            ReadSection(aCurSection, theDoc, theIStream);
+            ReadSection(aCurSection, theDoc, anIS);
         }
       }
-      theIStream.seekg(aDocumentPos);
+      anIS.seekg(aDocumentPos);
     }
   }
   else
   {                                                   // aFileVer < 3
-    std::streampos aDocumentPos = theIStream.tellg(); // position of root label
+    std::streampos aDocumentPos = anIS.tellg(); // position of root label
     // retrieve SHAPESECTION_POS string
     char aShapeSecLabel[SIZEOFSHAPELABEL + 1];
     aShapeSecLabel[SIZEOFSHAPELABEL] = 0x00;
-    theIStream.read((char*)&aShapeSecLabel, SIZEOFSHAPELABEL); // SHAPESECTION_POS
+    anIS.read((char*)&aShapeSecLabel, SIZEOFSHAPELABEL); // SHAPESECTION_POS
     AsciiString1 aShapeLabel(aShapeSecLabel);
     // detect if a file was written in old fashion (version 2 without shapes)
     // and if so then skip reading ShapeSection
@@ -300,7 +325,7 @@ void BinLDrivers_DocumentRetrievalDriver::Read(Standard_IStream&
 
       // retrieve ShapeSection Position1
       Standard_Integer aShapeSectionPos; // go to ShapeSection
-      theIStream.read((char*)&aShapeSectionPos, sizeof(Standard_Integer));
+      anIS.read((char*)&aShapeSectionPos, sizeof(Standard_Integer));
 
 #ifdef DO_INVERSE
       aShapeSectionPos = InverseInt(aShapeSectionPos);
@@ -310,13 +335,13 @@ void BinLDrivers_DocumentRetrievalDriver::Read(Standard_IStream&
 #endif
       if (aShapeSectionPos)
       {
-        aDocumentPos = theIStream.tellg();
-        theIStream.seekg((std::streampos)aShapeSectionPos);
+        aDocumentPos = anIS.tellg();
+        anIS.seekg((std::streampos)aShapeSectionPos);
 
-        CheckShapeSection(aShapeSectionPos, theIStream);
+        CheckShapeSection(aShapeSectionPos, anIS);
         // Read Shapes
         DocumentSection aCurSection;
-        ReadShapeSection(aCurSection, theIStream, Standard_False, aPS.Next());
+        ReadShapeSection(aCurSection, anIS, Standard_False, aPS.Next());
         if (!aPS.More())
         {
           myReaderStatus = PCDM_RS_UserBreak;
@@ -324,33 +349,33 @@ void BinLDrivers_DocumentRetrievalDriver::Read(Standard_IStream&
         }
       }
     }
-    theIStream.seekg(aDocumentPos);
+    anIS.seekg(aDocumentPos);
   } // end of reading Sections or shape section
 
   // Return to read of the Document structure
 
   // read the header (tag) of the root label
   Standard_Integer aTag;
-  theIStream.read((char*)&aTag, sizeof(Standard_Integer));
+  anIS.read((char*)&aTag, sizeof(Standard_Integer));
 
   if (aQuickPart)
-    myPAtt.SetIStream(theIStream); // for reading shapes data from the stream directly
+    myPAtt.SetIStream(anIS); // for reading shapes data from the stream directly
   EnableQuickPartReading(myMsgDriver, aQuickPart);
 
   // read sub-tree of the root label
   if (!theFilter.IsNull())
     theFilter->StartIteration();
-  const auto       aStreamStartPosition = theIStream.tellg();
+  const auto       aStreamStartPosition = anIS.tellg();
   Standard_Integer nbRead =
-    ReadSubTree(theIStream, aData->Root(), theFilter, aQuickPart, Standard_False, aPS.Next());
+    ReadSubTree(anIS, aData->Root(), theFilter, aQuickPart, Standard_False, aPS.Next());
   if (!myUnresolvedLinks.IsEmpty())
   {
     // In case we have skipped some linked TreeNodes before getting to
     // their children.
     theFilter->StartIteration();
-    theIStream.seekg(aStreamStartPosition, std::ios_base::beg);
+    anIS.seekg(aStreamStartPosition, std::ios_base::beg);
     nbRead +=
-      ReadSubTree(theIStream, aData->Root(), theFilter, aQuickPart, Standard_True, aPS.Next());
+      ReadSubTree(anIS, aData->Root(), theFilter, aQuickPart, Standard_True, aPS.Next());
   }
   if (!aPS.More())
   {
@@ -387,8 +412,8 @@ void BinLDrivers_DocumentRetrievalDriver::Read(Standard_IStream&
       DocumentSection& aCurSection = aSectIter.ChangeValue();
       if (aCurSection.IsPostRead())
       {
-        theIStream.seekg((std::streampos)aCurSection.Offset());
-        ReadSection(aCurSection, theDoc, theIStream);
+        anIS.seekg((std::streampos)aCurSection.Offset());
+        ReadSection(aCurSection, theDoc, anIS);
       }
     }
   }
@@ -671,7 +696,8 @@ Standard_Boolean BinLDrivers_DocumentRetrievalDriver::CheckDocumentVersion(
   const Standard_Integer theFileVersion,
   const Standard_Integer theCurVersion)
 {
-  if (theFileVersion < TDocStd_FormatVersion_LOWER || theFileVersion > theCurVersion)
+  if (theFileVersion < TDocStd_FormatVersion_LOWER
+      || theFileVersion > Max(theCurVersion, (Standard_Integer)TDocStd_FormatVersion_UPPER))
   {
     // file was written with another version
     return Standard_False;
@@ -685,3 +711,27 @@ Standard_Boolean BinLDrivers_DocumentRetrievalDriver::IsQuickPart(const Standard
 {
   return theFileVer >= TDocStd_FormatVersion_VERSION_12;
 }
+
+//=================================================================================================
+
+Handle(PCDM_RetrievalDriver) BinLDrivers_DocumentRetrievalDriver::Copy() const
+{
+  Handle(BinLDrivers_DocumentRetrievalDriver) aCopy = new BinLDrivers_DocumentRetrievalDriver();
+  InitCopy(aCopy);
+  return aCopy;
+}
+
+//=================================================================================================
+
+void BinLDrivers_DocumentRetrievalDriver::InitCopy(
+  const Handle(BinLDrivers_DocumentRetrievalDriver)& theCopy) const
+{
+  theCopy->SetFormat(GetFormat());
+
+  // the copy shares the attribute drivers, including the ones added by the application
+  Standard_Mutex::Sentry aLock(myDriversMutex);
+  if (!myDrivers.IsNull())
+  {
+    theCopy->myDrivers = myDrivers->Copy();
+  }
+}
@@ -65,9 +65,15 @@ public:
   Standard_EXPORT virtual Handle(AttributeDriverTable) AttributeDrivers(
     const Handle(Message_Messenger)& theMsgDriver);
 
+  //! Returns a new driver of the same type, with the format and options of this driver.
+  Standard_EXPORT virtual Handle(PCDM_RetrievalDriver) Copy() const Standard_OVERRIDE;
+
   DEFINE_STANDARD_RTTIEXT(BinLDrivers_DocumentRetrievalDriver, PCDM_RetrievalDriver)
 
 protected:
+  //! Passes the format and the table of attribute drivers of this driver to its copy.
+  Standard_EXPORT void InitCopy(const Handle(BinLDrivers_DocumentRetrievalDriver)& theCopy) const;
+
   //! Read the tree from the stream <theIS> to <theLabel>
   Standard_EXPORT virtual Standard_Integer ReadSubTree(
     Standard_IStream&                theIS,
@@ -99,8 +105,9 @@ protected:
   //! Check a file version(in which file was written) with a current version.
   //! Redefining this method is a chance for application to read files
   //! written by newer applications.
-  //! The default implementation: if the version of the file is greater than the
-  //! current or lesser than 2, then return false, else true
+  //! The default implementation: if the version of the file is greater than both the
+  //! current and the upper supported (written on request only) versions or lesser than 2,
+  //! then return false, else true
   Standard_EXPORT virtual Standard_Boolean CheckDocumentVersion(
     const Standard_Integer theFileVersion,
     const Standard_Integer theCurVersion);
@@ -116,8 +123,11 @@ protected:
   }
 
   Handle(AttributeDriverTable) myDrivers;
+  //! guards the creation of myDrivers while reading against its copying by another thread
+  mutable Standard_Mutex myDriversMutex;
   BinObjMgt_RRelocationTable  myRelocTable;
   Handle(Message_Messenger)   myMsgDriver;
+  Standard_Boolean            myIsChunked; //!< document data is read from compressed chunks
 
 private:
   BinObjMgt_Persistent                myPAtt;
@@ -14,6 +14,7 @@
 // commercial license or contractual agreement.
 
 #include <BinLDrivers.hxx>
+#include <BinLDrivers_ChunkedStreamBuffer.hxx>
 #include <BinLDrivers_DocumentStorageDriver.hxx>
 #include <BinLDrivers_Marker.hxx>
 #include <BinMDF_ADriverTable.hxx>
@@ -23,8 +24,11 @@
 #include <Message_Messenger.hxx>
 #include <FSD_BinaryFile.hxx>
 #include <FSD_FileHeader.hxx>
+#include <OSD_File.hxx>
 #include <OSD_FileSystem.hxx>
+#include <OSD_Path.hxx>
 #include <PCDM_ReadWriter.hxx>
+#include <Standard_ErrorHandler.hxx>
 #include <Standard_Type.hxx>
 #include <Storage_Schema.hxx>
 #include <TCollection_AsciiString.hxx>
@@ -57,19 +61,60 @@ void BinLDrivers_DocumentStorageDriver::Write(const Handle(CDM_Document)&
 
   myFileName = theFileName;
 
+  // An existing file is replaced only when the new one is written completely: the document
+  // may still read from it, e.g. the triangulations which have been left in the file on opening.
+  SystemFile                aTargetFile((SystemPath(theFileName)));
+  const Standard_Boolean    toReplace = aTargetFile.Exists();
+  const UtfString aFileName = toReplace ? theFileName + ".tmp" : theFileName;
+
   const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
   std::shared_ptr<std::ostream> aFileStream =
-    aFileSystem->OpenOStream(theFileName, std::ios::out | std::ios::binary);
+    aFileSystem->OpenOStream(aFileName, std::ios::out | std::ios::binary);
 
   if (aFileStream.get() != NULL && aFileStream->good())
   {
-    Write(theDocument, *aFileStream, theRange);
+    try
+    {
+      OCC_CATCH_SIGNALS
+      Write(theDocument, *aFileStream, theRange);
+    }
+    catch (ExceptionBase const&)
+    {
+      aFileStream.reset();
+      if (toReplace)
+        SystemFile(SystemPath(aFileName)).Remove();
+      throw;
+    }
+    aFileStream->flush();
+    if (!aFileStream->good() && !IsError())
+    {
+      SetIsError(Standard_True);
+      SetStoreStatus(PCDM_SS_WriteFailure);
+    }
+    aFileStream.reset();
   }
   else
   {
     SetIsError(Standard_True);
     SetStoreStatus(PCDM_SS_WriteFailure);
   }
+
+  if (toReplace)
+  {
+    SystemFile aTempFile((SystemPath(aFileName)));
+    if (IsError())
+    {
+      aTempFile.Remove();
+      return;
+    }
+    aTempFile.Move(SystemPath(theFileName));
+    if (aTempFile.Failed())
+    {
+      aTempFile.Remove();
+      SetIsError(Standard_True);
+      SetStoreStatus(PCDM_SS_WriteFailure);
+    }
+  }
 }
 
 //=================================================================================================
@@ -92,7 +137,11 @@ void BinLDrivers_DocumentStorageDriver::Write(const Handle(CDM_Document)&  theDo
   {
     // First pass: collect empty labels, assign IDs to the types
     if (myDrivers.IsNull())
-      myDrivers = AttributeDrivers(myMsgDriver);
+    {
+      Handle(AttributeDriverTable) aDrivers = AttributeDrivers(myMsgDriver);
+      Standard_Mutex::Sentry       aLock(myDriversMutex);
+      myDrivers = aDrivers;
+    }
     Handle(Data2) aData = aDoc->GetData();
     FirstPass(aData->Root());
     if (aDoc->EmptyLabelsSavingMode())
@@ -108,11 +157,29 @@ void BinLDrivers_DocumentStorageDriver::Write(const Handle(CDM_Document)&  theDo
       return;
     }
 
+    // Since version 13 the data following the information section is written through the
+    // buffer compressing it by chunks as they are filled. Positions in the buffer are those of
+    // the uncompressed document, so the positions of sections remain valid.
+    const TDocStd_FormatVersion     aDocVer   = aDoc->StorageFormatVersion();
+    const Standard_Boolean          isChunked = aDocVer >= TDocStd_FormatVersion_VERSION_13;
+    BinLDrivers_ChunkedStreamBuffer aChunkedBuffer;
+    Standard_OStream                aChunkedStream(&aChunkedBuffer);
+    if (isChunked
+        && !aChunkedBuffer.InitWrite(theOStream,
+                                     (uint64_t)theOStream.tellp(),
+                                     BinLDrivers_ChunkedStreamBuffer::THE_DEFAULT_CHUNK_SIZE,
+                                     Standard_True))
+    {
+      SetIsError(Standard_True);
+      SetStoreStatus(PCDM_SS_WriteFailure);
+      return;
+    }
+    Standard_OStream& anOS = isChunked ? aChunkedStream : theOStream;
+
     //  2. Write the Table of Contents of Sections
-    const TDocStd_FormatVersion                   aDocVer = aDoc->StorageFormatVersion();
     BinLDrivers_VectorOfDocumentSection::Iterator anIterS(mySections);
     for (; anIterS.More(); anIterS.Next())
-      anIterS.ChangeValue().WriteTOC(theOStream, aDocVer);
+      anIterS.ChangeValue().WriteTOC(anOS, aDocVer);
 
     EnableQuickPartWriting(myMsgDriver, IsQuickPart(aDocVer));
     DocumentSection* aShapesSection = 0;
@@ -121,13 +188,13 @@ void BinLDrivers_DocumentStorageDriver::Write(const Handle(CDM_Document)&  theDo
     {
       // Shapes Section is the last one, it indicates the end of the table.
       aShapesSection = new DocumentSection(SHAPESECTION_POS, Standard_False);
-      aShapesSection->WriteTOC(theOStream, aDocVer);
+      aShapesSection->WriteTOC(anOS, aDocVer);
     }
     else
     {
       // End Section is the last one, it indicates the end of the table.
       DocumentSection anEndSection(ENDSECTION_POS, Standard_False);
-      anEndSection.WriteTOC(theOStream, aDocVer);
+      anEndSection.WriteTOC(anOS, aDocVer);
     }
 
     //  3. Write document contents
@@ -135,12 +202,12 @@ void BinLDrivers_DocumentStorageDriver::Write(const Handle(CDM_Document)&  theDo
     myRelocTable.Clear();
     myPAtt.Init();
     if (aQuickPart)
-      myPAtt.SetOStream(theOStream); // for writing shapes data into the stream directly
+      myPAtt.SetOStream(anOS); // for writing shapes data into the stream directly
 
     Message_ProgressScope aPS(theRange, "Writing document", 3);
 
     //  Write Doc structure
-    WriteSubTree(aData->Root(), theOStream, aQuickPart, aPS.Next()); // Doc is written
+    WriteSubTree(aData->Root(), anOS, aQuickPart, aPS.Next()); // Doc is written
     if (!aPS.More())
     {
       SetIsError(Standard_True);
@@ -151,7 +218,7 @@ void BinLDrivers_DocumentStorageDriver::Write(const Handle(CDM_Document)&  theDo
     //  4. Write Shapes section
     if (!aQuickPart)
     {
-      WriteShapeSection(*aShapesSection, theOStream, aDocVer, aPS.Next());
+      WriteShapeSection(*aShapesSection, anOS, aDocVer, aPS.Next());
       delete aShapesSection;
     }
     else
@@ -168,14 +235,20 @@ void BinLDrivers_DocumentStorageDriver::Write(const Handle(CDM_Document)&  theDo
     for (anIterS.Init(mySections); anIterS.More(); anIterS.Next())
     {
       DocumentSection& aSection       = anIterS.ChangeValue();
-      const Standard_Size          aSectionOffset = (Standard_Size)theOStream.tellp();
-      WriteSection(aSection.Name(), aDoc, theOStream);
-      aSection.Write(theOStream, aSectionOffset, aDocVer);
+      const Standard_Size          aSectionOffset = (Standard_Size)anOS.tellp();
+      WriteSection(aSection.Name(), aDoc, anOS);
+      aSection.Write(anOS, aSectionOffset, aDocVer);
     }
 
     //  5. Write sizes along the file where it is needed for quick part mode
     if (aQuickPart)
-      WriteSizes(theOStream);
+      WriteSizes(anOS);
+
+    if (isChunked && (!aChunkedStream.good() || !aChunkedBuffer.FinishWrite()))
+    {
+      SetIsError(Standard_True);
+      SetStoreStatus(PCDM_SS_WriteFailure);
+    }
 
     // End of processing: close structures and check the status
     myPAtt.Destroy(); // free buffer
@@ -586,3 +659,27 @@ void BinLDrivers_DocumentStorageDriver::WriteSizes(Standard_OStream& theOS)
     anIter.Value()->WriteSize(theOS);
   mySizesToWrite.Clear();
 }
+
+//=================================================================================================
+
+Handle(PCDM_StorageDriver) BinLDrivers_DocumentStorageDriver::Copy() const
+{
+  Handle(BinLDrivers_DocumentStorageDriver) aCopy = new BinLDrivers_DocumentStorageDriver();
+  InitCopy(aCopy);
+  return aCopy;
+}
+
+//=================================================================================================
+
+void BinLDrivers_DocumentStorageDriver::InitCopy(
+  const Handle(BinLDrivers_DocumentStorageDriver)& theCopy) const
+{
+  theCopy->SetFormat(GetFormat());
+
+  // the copy shares the attribute drivers, including the ones added by the application
+  Standard_Mutex::Sentry aLock(myDriversMutex);
+  if (!myDrivers.IsNull())
+  {
+    theCopy->myDrivers = myDrivers->Copy();
+  }
+}
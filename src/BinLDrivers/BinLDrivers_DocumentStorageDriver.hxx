@@ -69,9 +69,15 @@ public:
   //! Return true if document should be stored in quick mode for partial reading
   Standard_EXPORT Standard_Boolean IsQuickPart(const Standard_Integer theVersion) const;
 
+  //! Returns a new driver of the same type, with the format and options of this driver.
+  Standard_EXPORT virtual Handle(PCDM_StorageDriver) Copy() const Standard_OVERRIDE;
+
   DEFINE_STANDARD_RTTIEXT(BinLDrivers_DocumentStorageDriver, PCDM_StorageDriver)
 
 protected:
+  //! Passes the format and the table of attribute drivers of this driver to its copy.
+  Standard_EXPORT void InitCopy(const Handle(BinLDrivers_DocumentStorageDriver)& theCopy) const;
+
   //! Write the tree under <theLabel> to the stream <theOS>
   Standard_EXPORT void WriteSubTree(
     const DataLabel&             theData,
@@ -102,6 +108,8 @@ protected:
   Standard_EXPORT virtual void Clear();
 
   Handle(AttributeDriverTable) myDrivers;
+  //! guards the creation of myDrivers while writing against its copying by another thread
+  mutable Standard_Mutex myDriversMutex;
   BinObjMgt_SRelocationTable  myRelocTable;
   Handle(Message_Messenger)   myMsgDriver;
 
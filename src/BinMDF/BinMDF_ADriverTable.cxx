@@ -37,6 +37,7 @@ AttributeDriverTable::AttributeDriverTable() {}
 void AttributeDriverTable::AddDriver(const Handle(BinMDF_ADriver)& theDriver)
 {
   const Handle(TypeInfo)& aType = theDriver->SourceType();
+  Standard_Mutex::Sentry       aLock(myMutex);
   myMap.Bind(aType, theDriver);
 }
 
@@ -53,6 +54,7 @@ void AttributeDriverTable::AddDerivedDriver(const Handle(TDF_Attribute)& theInst
       if (myMap.IsBound(aType))
       {
         Handle(BinMDF_DerivedDriver) aDriver = new BinMDF_DerivedDriver(theInstance, myMap(aType));
+        Standard_Mutex::Sentry       aLock(myMutex);
         myMap.Bind(anInstanceType, aDriver);
         return;
       }
@@ -144,3 +146,13 @@ void AttributeDriverTable::AssignIds(const TColStd_SequenceOfAsciiString& theTyp
     }
   }
 }
+
+//=================================================================================================
+
+Handle(AttributeDriverTable) AttributeDriverTable::Copy() const
+{
+  Handle(AttributeDriverTable) aCopy = new AttributeDriverTable();
+  Standard_Mutex::Sentry        aLock(myMutex);
+  aCopy->myMap.Assign(myMap);
+  return aCopy;
+}
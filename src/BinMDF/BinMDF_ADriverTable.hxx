@@ -23,6 +23,7 @@
 #include <BinMDF_TypeIdMap.hxx>
 #include <Standard_Transient.hxx>
 #include <Standard_Integer.hxx>
+#include <Standard_Mutex.hxx>
 #include <TColStd_IndexedMapOfTransient.hxx>
 #include <TColStd_SequenceOfAsciiString.hxx>
 class BinMDF_ADriver;
@@ -72,6 +73,11 @@ public:
   //! Returns null handle if a driver is not found
   Handle(BinMDF_ADriver) GetDriver(const Standard_Integer theTypeId);
 
+  //! Returns a new table sharing the drivers of this one, to be used by a copy
+  //! of the document driver. The type IDs are not copied, as they are assigned per document;
+  //! the drivers keeping the data of the document being translated should be replaced in the copy.
+  Standard_EXPORT Handle(AttributeDriverTable) Copy() const;
+
   DEFINE_STANDARD_RTTIEXT(AttributeDriverTable, RefObject)
 
 protected:
@@ -81,6 +87,8 @@ private:
 
   BinMDF_TypeADriverMap myMap;
   BinMDF_TypeIdMap      myMapId;
+  //! guards the modifications of myMap against its copying by another thread
+  mutable Standard_Mutex myMutex;
 };
 
 #include <BinMDF_ADriverTable.lxx>
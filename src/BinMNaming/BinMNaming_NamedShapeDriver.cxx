@@ -391,7 +391,11 @@ ShapeSetBase* BinMNaming_NamedShapeDriver::ShapeSet(const Standard_Boolean theRe
     if (myIsQuickPart)
     {
       if (theReading)
-        myShapeSet = new BinaryShapeReader();
+      {
+        BinaryShapeReader* aReader = new BinaryShapeReader();
+        aReader->SetDeferredTriangulationFile(myDeferredFile);
+        myShapeSet = aReader;
+      }
       else
         myShapeSet = new BinaryShapeWriter();
     }
@@ -405,6 +409,16 @@ ShapeSetBase* BinMNaming_NamedShapeDriver::ShapeSet(const Standard_Boolean theRe
 
 //=================================================================================================
 
+void BinMNaming_NamedShapeDriver::SetDeferredTriangulationFile(
+  const AsciiString1& theFileName)
+{
+  myDeferredFile = theFileName;
+  if (BinaryShapeReader* aReader = dynamic_cast<BinaryShapeReader*>(myShapeSet))
+    aReader->SetDeferredTriangulationFile(theFileName);
+}
+
+//=================================================================================================
+
 LocationBinarySet& BinMNaming_NamedShapeDriver::GetShapesLocations() const
 {
   ShapeSetBase* aShapeSet =
@@ -25,6 +25,7 @@
 #include <BinObjMgt_SRelocationTable.hxx>
 #include <Standard_IStream.hxx>
 #include <Standard_OStream.hxx>
+#include <TCollection_AsciiString.hxx>
 class Message_Messenger;
 class TDF_Attribute;
 class BinObjMgt_Persistent;
@@ -88,6 +89,15 @@ public:
   //! attribute.
   Standard_EXPORT Standard_Boolean IsQuickPart() { return myIsQuickPart; }
 
+  //! Returns the file from which the triangulations of shapes read in the quick part access mode
+  //! are loaded on request, empty if the triangulations are read together with the shapes.
+  const AsciiString1& DeferredTriangulationFile() const { return myDeferredFile; }
+
+  //! Sets the file being read in the quick part access mode to restore triangulations of shapes
+  //! as BinTools_DeferredTriangulation loading their data from this file on request
+  //! (see BinaryShapeReader::SetDeferredTriangulationFile()); empty name disables it.
+  Standard_EXPORT void SetDeferredTriangulationFile(const AsciiString1& theFileName);
+
   //! Returns shape-set of the needed type
   Standard_EXPORT ShapeSetBase* ShapeSet(const Standard_Boolean theReading);
 
@@ -99,6 +109,8 @@ private:
   Standard_Boolean       myWithNormals;
   //! Enables storing of whole shape data just in the attribute, not in a separated shapes section
   Standard_Boolean myIsQuickPart;
+  //! File to load the data of triangulations on request while reading in the quick part mode
+  AsciiString1 myDeferredFile;
 };
 
 #include <BinMNaming_NamedShapeDriver.lxx>
@@ -31,6 +31,7 @@
 #include <BinMXCAFDoc_VisMaterialToolDriver.hxx>
 #include <Message_Messenger.hxx>
 #include <TNaming_NamedShape.hxx>
+#include <XCAFDoc_Location.hxx>
 
 //=================================================================================================
 
@@ -64,3 +65,34 @@ void BinMXCAFDoc1::AddDrivers(const Handle(AttributeDriverTable)& theDriverTable
   theDriverTable->AddDriver(new BinMXCAFDoc_NoteCommentDriver(theMsgDrv));
   theDriverTable->AddDriver(new BinMXCAFDoc_VisMaterialToolDriver(theMsgDrv));
 }
+
+//=================================================================================================
+
+Standard_Boolean BinMXCAFDoc1::RelinkLocationDriver(
+  const Handle(AttributeDriverTable)& theDriverTable)
+{
+  Handle(BinMDF_ADriver) aDriver;
+  theDriverTable->GetDriver(STANDARD_TYPE(XCAFDoc_Location), aDriver);
+  if (aDriver.IsNull())
+  {
+    return Standard_True;
+  }
+  if (aDriver->DynamicType() != STANDARD_TYPE(BinMXCAFDoc_LocationDriver))
+  {
+    return Standard_False;
+  }
+
+  Handle(BinMDF_ADriver) aNSDriver;
+  theDriverTable->GetDriver(STANDARD_TYPE(ShapeAttribute), aNSDriver);
+  Handle(BinMNaming_NamedShapeDriver) aNamedShapeDriver =
+    Handle(BinMNaming_NamedShapeDriver)::DownCast(aNSDriver);
+
+  Handle(BinMXCAFDoc_LocationDriver) aLocationDriver =
+    new BinMXCAFDoc_LocationDriver(aDriver->MessageDriver());
+  if (!aNamedShapeDriver.IsNull())
+  {
+    aLocationDriver->SetNSDriver(aNamedShapeDriver);
+  }
+  theDriverTable->AddDriver(aLocationDriver);
+  return Standard_True;
+}
@@ -31,6 +31,13 @@ public:
   //! Adds the attribute drivers to <theDriverTable>.
   Standard_EXPORT static void AddDrivers(const Handle(AttributeDriverTable)& theDriverTable,
                                          const Handle(Message_Messenger)&   theMsgDrv);
+
+  //! Replaces the driver of locations in <theDriverTable> by a new one sharing the locations
+  //! of the driver of shapes of this table. It is used for the tables copied for the copies
+  //! of document drivers, in which the driver of shapes is replaced.
+  //! Returns FALSE if the driver of locations is redefined and cannot be replaced.
+  Standard_EXPORT static Standard_Boolean RelinkLocationDriver(
+    const Handle(AttributeDriverTable)& theDriverTable);
 };
 
 #endif // _BinMXCAFDoc_HeaderFile
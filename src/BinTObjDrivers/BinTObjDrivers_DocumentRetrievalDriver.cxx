@@ -42,3 +42,12 @@ Handle(AttributeDriverTable) BinTObjDrivers_DocumentRetrievalDriver::AttributeDr
 
   return aTable;
 }
+
+//=================================================================================================
+
+Handle(PCDM_RetrievalDriver) BinTObjDrivers_DocumentRetrievalDriver::Copy() const
+{
+  Handle(BinTObjDrivers_DocumentRetrievalDriver) aCopy = new BinTObjDrivers_DocumentRetrievalDriver();
+  InitCopy(aCopy);
+  return aCopy;
+}
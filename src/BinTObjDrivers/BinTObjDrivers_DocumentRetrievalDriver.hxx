@@ -35,6 +35,9 @@ public:
   Standard_EXPORT virtual Handle(AttributeDriverTable) AttributeDrivers(
     const Handle(Message_Messenger)& theMsgDriver) Standard_OVERRIDE;
 
+  //! Returns a new driver of the same type, with the format and options of this driver.
+  Standard_EXPORT virtual Handle(PCDM_RetrievalDriver) Copy() const Standard_OVERRIDE;
+
 public:
   // Declaration of CASCADE RTTI
   DEFINE_STANDARD_RTTIEXT(BinTObjDrivers_DocumentRetrievalDriver,
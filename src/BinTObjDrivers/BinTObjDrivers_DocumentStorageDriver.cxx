@@ -41,3 +41,12 @@ Handle(AttributeDriverTable) BinTObjDrivers_DocumentStorageDriver::AttributeDriv
 
   return aTable;
 }
+
+//=================================================================================================
+
+Handle(PCDM_StorageDriver) BinTObjDrivers_DocumentStorageDriver::Copy() const
+{
+  Handle(BinTObjDrivers_DocumentStorageDriver) aCopy = new BinTObjDrivers_DocumentStorageDriver();
+  InitCopy(aCopy);
+  return aCopy;
+}
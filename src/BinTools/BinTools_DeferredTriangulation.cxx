@@ -0,0 +1,123 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BinTools_DeferredTriangulation.hxx>
+
+#include <BinTools_IStream.hxx>
+#include <OSD_FileSystem.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <Standard_Failure.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BinTools_DeferredTriangulation, MeshTriangulation)
+
+//=================================================================================================
+
+BinTools_DeferredTriangulation::BinTools_DeferredTriangulation(
+  const AsciiString1& theFileName,
+  const int64_t                  theOffset,
+  const Standard_Integer         theNbNodes,
+  const Standard_Integer         theNbTriangles,
+  const Standard_Boolean         theHasUVNodes,
+  const Standard_Boolean         theHasNormals)
+    : myFileName(theFileName),
+      myOffset(theOffset),
+      myNbDefNodes(theNbNodes),
+      myNbDefTriangles(theNbTriangles),
+      myHasDefUVNodes(theHasUVNodes),
+      myHasDefNormals(theHasNormals)
+{
+}
+
+//=================================================================================================
+
+uint64_t BinTools_DeferredTriangulation::DataSize(const Standard_Integer theNbNodes,
+                                                  const Standard_Integer theNbTriangles,
+                                                  const Standard_Boolean theHasUVNodes,
+                                                  const Standard_Boolean theHasNormals)
+{
+  uint64_t aNodeSize = 3 * sizeof(Standard_Real);
+  if (theHasUVNodes)
+    aNodeSize += 2 * sizeof(Standard_Real);
+  if (theHasNormals)
+    aNodeSize += 3 * sizeof(Standard_ShortReal);
+  return aNodeSize * uint64_t(theNbNodes)
+         + 3 * sizeof(Standard_Integer) * uint64_t(theNbTriangles);
+}
+
+//=================================================================================================
+
+Standard_Boolean BinTools_DeferredTriangulation::loadDeferredData(
+  const Handle(OSD_FileSystem)&     theFileSystem,
+  const Handle(MeshTriangulation)& theDestTriangulation) const
+{
+  const Handle(OSD_FileSystem)& aFileSystem =
+    !theFileSystem.IsNull() ? theFileSystem : OSD_FileSystem::DefaultFileSystem();
+  std::shared_ptr<std::istream> aFile =
+    aFileSystem->OpenIStream(myFileName, std::ios::in | std::ios::binary, myOffset);
+  if (aFile.get() == NULL || !aFile->good())
+  {
+    return Standard_False;
+  }
+
+  try
+  {
+    OCC_CATCH_SIGNALS
+    BinaryInputStream aStream(*aFile);
+    theDestTriangulation->Clear();
+    theDestTriangulation->ResizeNodes(myNbDefNodes, Standard_False);
+    theDestTriangulation->ResizeTriangles(myNbDefTriangles, Standard_False);
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= myNbDefNodes; ++aNodeIter)
+      theDestTriangulation->SetNode(aNodeIter, aStream.ReadPnt());
+    if (myHasDefUVNodes)
+    {
+      theDestTriangulation->AddUVNodes();
+      gp_Pnt2d anUV;
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= myNbDefNodes; ++aNodeIter)
+      {
+        aStream >> anUV.ChangeCoord().ChangeCoord(1);
+        aStream >> anUV.ChangeCoord().ChangeCoord(2);
+        theDestTriangulation->SetUVNode(aNodeIter, anUV);
+      }
+    }
+    Triangle2 aTriangle;
+    for (Standard_Integer aTriIter = 1; aTriIter <= myNbDefTriangles; ++aTriIter)
+    {
+      aStream >> aTriangle.ChangeValue(1);
+      aStream >> aTriangle.ChangeValue(2);
+      aStream >> aTriangle.ChangeValue(3);
+      theDestTriangulation->SetTriangle(aTriIter, aTriangle);
+    }
+    if (myHasDefNormals)
+    {
+      theDestTriangulation->AddNormals();
+      gp_Vec3f aNormal;
+      for (Standard_Integer aNormalIter = 1; aNormalIter <= myNbDefNodes; ++aNormalIter)
+      {
+        aStream >> aNormal.x();
+        aStream >> aNormal.y();
+        aStream >> aNormal.z();
+        theDestTriangulation->SetNormal(aNormalIter, aNormal);
+      }
+    }
+    if (theDestTriangulation != this)
+    {
+      theDestTriangulation->Deflection(Deflection());
+    }
+    return aStream ? Standard_True : Standard_False;
+  }
+  catch (ExceptionBase const&)
+  {
+    theDestTriangulation->Clear();
+    return Standard_False;
+  }
+}
@@ -0,0 +1,79 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BinTools_DeferredTriangulation_HeaderFile
+#define _BinTools_DeferredTriangulation_HeaderFile
+
+#include <Poly_Triangulation.hxx>
+#include <TCollection_AsciiString.hxx>
+
+DEFINE_STANDARD_HANDLE(BinTools_DeferredTriangulation, MeshTriangulation)
+
+//! Triangulation restored by BinaryShapeReader without its nodes, triangles and normals.
+//! The data stays in the file and is loaded on request by LoadDeferredData()
+//! (or through Poly_TriangulationCache) and released by UnloadDeferredData().
+class BinTools_DeferredTriangulation : public MeshTriangulation
+{
+  DEFINE_STANDARD_RTTIEXT(BinTools_DeferredTriangulation, MeshTriangulation)
+public:
+  //! Creates a triangulation which data is stored in the file.
+  //! @param[in] theFileName     path to the file
+  //! @param[in] theOffset       position of the first node in the file
+  //! @param[in] theNbNodes      number of nodes
+  //! @param[in] theNbTriangles  number of triangles
+  //! @param[in] theHasUVNodes   flag indicating that UV nodes are stored
+  //! @param[in] theHasNormals   flag indicating that normals are stored
+  Standard_EXPORT BinTools_DeferredTriangulation(const AsciiString1& theFileName,
+                                                 const int64_t                  theOffset,
+                                                 const Standard_Integer         theNbNodes,
+                                                 const Standard_Integer         theNbTriangles,
+                                                 const Standard_Boolean         theHasUVNodes,
+                                                 const Standard_Boolean         theHasNormals);
+
+  //! Returns path to the file with the data.
+  const AsciiString1& FileName() const { return myFileName; }
+
+  //! Returns position of the data in the file.
+  int64_t Offset() const { return myOffset; }
+
+  //! Returns number of nodes stored in the file.
+  virtual Standard_Integer NbDeferredNodes() const Standard_OVERRIDE { return myNbDefNodes; }
+
+  //! Returns number of triangles stored in the file.
+  virtual Standard_Integer NbDeferredTriangles() const Standard_OVERRIDE
+  {
+    return myNbDefTriangles;
+  }
+
+  //! Returns size in bytes of the triangulation data written by BinaryShapeWriter.
+  Standard_EXPORT static uint64_t DataSize(const Standard_Integer theNbNodes,
+                                           const Standard_Integer theNbTriangles,
+                                           const Standard_Boolean theHasUVNodes,
+                                           const Standard_Boolean theHasNormals);
+
+protected:
+  //! Reads the data from the file into the given triangulation.
+  Standard_EXPORT virtual Standard_Boolean loadDeferredData(
+    const Handle(OSD_FileSystem)&     theFileSystem,
+    const Handle(MeshTriangulation)& theDestTriangulation) const Standard_OVERRIDE;
+
+private:
+  AsciiString1 myFileName;
+  int64_t                 myOffset;
+  Standard_Integer        myNbDefNodes;
+  Standard_Integer        myNbDefTriangles;
+  Standard_Boolean        myHasDefUVNodes;
+  Standard_Boolean        myHasDefNormals;
+};
+
+#endif // _BinTools_DeferredTriangulation_HeaderFile
@@ -27,13 +27,17 @@ enum BinTools_FormatVersion
   BinTools_FormatVersion_VERSION_4 = 4, //!< Stores per-vertex normal information in case
                                         //!  of triangulation-only Faces, because
                                         //!  no analytical geometry to restore normals
+  BinTools_FormatVersion_VERSION_5 = 5, //!< Stores the sizes of the geometry sections before them,
+                                        //!  so that the sections are read in parallel.
+                                        //!  Not used by OCAF documents, which store shapes
+                                        //!  in their attributes since version 12
   BinTools_FormatVersion_CURRENT = BinTools_FormatVersion_VERSION_4 //!< Current version
 };
 
 enum
 {
   BinTools_FormatVersion_LOWER = BinTools_FormatVersion_VERSION_1,
-  BinTools_FormatVersion_UPPER = BinTools_FormatVersion_VERSION_4
+  BinTools_FormatVersion_UPPER = BinTools_FormatVersion_VERSION_5
 };
 
 #endif
@@ -15,6 +15,7 @@
 
 #include <BinTools_Curve2dSet.hxx>
 #include <BinTools_CurveSet.hxx>
+#include <BinTools_DeferredTriangulation.hxx>
 #include <BinTools_SurfaceSet.hxx>
 #include <BRep_Builder.hxx>
 #include <BRep_PointOnCurve.hxx>
@@ -532,8 +533,26 @@ Handle(MeshTriangulation) BinaryShapeReader::ReadTriangulation(BinaryInputStream
     Standard_Integer aNbTriangles = theStream.ReadInteger();
     Standard_Boolean aHasUV       = theStream.ReadBool();
     Standard_Boolean aHasNormals  = theStream.ReadBool();
+    Standard_Real    aDeflection  = theStream.ReadReal();
+    if (!myDeferredFile.IsEmpty() && aNbTriangles > 0)
+    {
+      // skip the data, it is loaded from the file on request
+      const uint64_t aDataPos = theStream.Position1();
+      aResult = new BinTools_DeferredTriangulation(myDeferredFile,
+                                                   int64_t(aDataPos),
+                                                   aNbNodes,
+                                                   aNbTriangles,
+                                                   aHasUV,
+                                                   aHasNormals);
+      aResult->Deflection(aDeflection);
+      theStream.GoTo(
+        aDataPos
+        + BinTools_DeferredTriangulation::DataSize(aNbNodes, aNbTriangles, aHasUV, aHasNormals));
+      myTriangulationPos.Bind(aPosition, aResult);
+      return aResult;
+    }
     aResult = new MeshTriangulation(aNbNodes, aNbTriangles, aHasUV, aHasNormals);
-    aResult->Deflection(theStream.ReadReal());
+    aResult->Deflection(aDeflection);
     for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
       aResult->SetNode(aNodeIter, theStream.ReadPnt());
     if (aHasUV)
@@ -17,6 +17,7 @@
 #include <BinTools_ShapeSetBase.hxx>
 #include <BinTools_IStream.hxx>
 #include <NCollection_DataMap.hxx>
+#include <TCollection_AsciiString.hxx>
 #include <TopLoc_Location.hxx>
 #include <TopoDS_Shape.hxx>
 
@@ -48,6 +49,19 @@ public:
   //! Reads location from the stream.
   Standard_EXPORT const TopLoc_Location* ReadLocation(BinaryInputStream& theStream);
 
+  //! Returns the file from which the data of triangulations is loaded on request,
+  //! empty if triangulations are read completely.
+  const AsciiString1& DeferredTriangulationFile() const { return myDeferredFile; }
+
+  //! Sets the file being read: triangulations are restored as BinTools_DeferredTriangulation,
+  //! their nodes, triangles and normals are skipped and loaded from the file on request.
+  //! The stream positions should be the positions in this file.
+  //! Empty name (default) makes triangulations read completely.
+  void SetDeferredTriangulationFile(const AsciiString1& theFileName)
+  {
+    myDeferredFile = theFileName;
+  }
+
 private:
   //! Reads the shape from stream using previously restored shapes and objects by references.
   TopoShape ReadShape(BinaryInputStream& theStream);
@@ -73,6 +87,8 @@ private:
   NCollection_DataMap<uint64_t, Handle(Poly_Polygon3D)>              myPolygon3dPos;
   NCollection_DataMap<uint64_t, Handle(Poly_PolygonOnTriangulation)> myPolygonPos;
   NCollection_DataMap<uint64_t, Handle(MeshTriangulation)>          myTriangulationPos;
+  /// file to load the data of triangulations on request
+  AsciiString1 myDeferredFile;
 };
 
 #endif // _BinTools_ShapeReader_HeaderFile
@@ -36,6 +36,9 @@
 #include <Poly_Polygon3D.hxx>
 #include <Poly_PolygonOnTriangulation.hxx>
 #include <Poly_Triangulation.hxx>
+#include <NCollection_Buffer.hxx>
+#include <OSD_Parallel.hxx>
+#include <Standard_ArrayStreamBuffer.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <TColStd_HArray1OfInteger.hxx>
 #include <TColStd_HArray1OfReal.hxx>
@@ -45,8 +48,20 @@
 #include <TopoDS_Vertex.hxx>
 #include <Message_ProgressRange.hxx>
 
+#include <iomanip>
 #include <string.h>
 
+//! Number of geometry sections: 2D curves, 3D curves, 3D polygons, polygons on triangulations,
+//! surfaces and triangulations, in the order of writing.
+static const Standard_Integer THE_NB_GEOMETRY_SECTIONS = 6;
+
+//! Maximal total size of geometry sections loaded into memory at once for parallel decoding,
+//! larger sections are decoded directly from the input stream.
+static const Standard_Size THE_MAX_BUFFERED_SECTIONS_SIZE = 64 * 1024 * 1024;
+
+//! Width of the sizes in the table of geometry sections.
+static const int THE_GEOMETRY_SIZE_WIDTH = 20;
+
 //=================================================================================================
 
 BinTools_ShapeSet::BinTools_ShapeSet()
@@ -254,26 +269,108 @@ void BinTools_ShapeSet::AddShape(const TopoShape& S)
 
 //=================================================================================================
 
+//! Writes the table of sizes of geometry sections.
+//! The sizes have the fixed width, so that the table can be rewritten in place.
+static void writeGeometrySizes(Standard_OStream& theStream, const Standard_Size theSizes[])
+{
+  for (Standard_Integer aSection = 0; aSection < THE_NB_GEOMETRY_SECTIONS; ++aSection)
+  {
+    theStream << " " << std::setw(THE_GEOMETRY_SIZE_WIDTH) << theSizes[aSection];
+  }
+  theStream << "\n";
+}
+
+//=================================================================================================
+
 void BinTools_ShapeSet::WriteGeometry(Standard_OStream&            OS,
                                       const Message_ProgressRange& theRange) const
 {
-  Message_ProgressScope aPS(theRange, "Writing geometry", 6);
-  myCurves2d.Write(OS, aPS.Next());
-  if (!aPS.More())
-    return;
-  myCurves.Write(OS, aPS.Next());
-  if (!aPS.More())
-    return;
-  WritePolygon3D(OS, aPS.Next());
-  if (!aPS.More())
+  Message_ProgressScope aPS(theRange, "Writing geometry", THE_NB_GEOMETRY_SECTIONS);
+  if (FormatNb() < BinTools_FormatVersion_VERSION_5)
+  {
+    for (Standard_Integer aSection = 0; aSection < THE_NB_GEOMETRY_SECTIONS && aPS.More();
+         ++aSection)
+    {
+      writeGeometrySection(aSection, OS, aPS.Next());
+    }
     return;
-  WritePolygonOnTriangulation(OS, aPS.Next());
-  if (!aPS.More())
+  }
+
+  // the stream gets the sizes of the sections followed by their content, so that they can be
+  // read in parallel. The sections are written directly and the sizes are put into the table
+  // reserved before them, unless the stream cannot be positioned
+  OS << "\nGeometrySections " << THE_NB_GEOMETRY_SECTIONS;
+  const std::streampos aTablePos = OS.tellp();
+  if (aTablePos != std::streampos(-1))
+  {
+    Standard_Size aSizes[THE_NB_GEOMETRY_SECTIONS] = {};
+    writeGeometrySizes(OS, aSizes);
+    for (Standard_Integer aSection = 0; aSection < THE_NB_GEOMETRY_SECTIONS && aPS.More();
+         ++aSection)
+    {
+      const std::streampos aSectionPos = OS.tellp();
+      writeGeometrySection(aSection, OS, aPS.Next());
+      aSizes[aSection] = (Standard_Size)(OS.tellp() - aSectionPos);
+    }
+    const std::streampos anEndPos = OS.tellp();
+    OS.seekp(aTablePos);
+    writeGeometrySizes(OS, aSizes);
+    OS.seekp(anEndPos);
     return;
-  mySurfaces.Write(OS, aPS.Next());
+  }
+
+  // the sections are written to separate buffers by several threads to know their sizes
+  Message_ProgressRange aRanges[THE_NB_GEOMETRY_SECTIONS];
+  Standard_SStream      aSections[THE_NB_GEOMETRY_SECTIONS];
+  for (Standard_Integer aSection = 0; aSection < THE_NB_GEOMETRY_SECTIONS; ++aSection)
+  {
+    aRanges[aSection] = aPS.Next();
+  }
+  Parallel1::For(0, THE_NB_GEOMETRY_SECTIONS, [&](const Standard_Integer theSection) {
+    writeGeometrySection(theSection, aSections[theSection], aRanges[theSection]);
+  });
   if (!aPS.More())
     return;
-  WriteTriangulation(OS, aPS.Next());
+
+  Standard_Size aSizes[THE_NB_GEOMETRY_SECTIONS];
+  for (Standard_Integer aSection = 0; aSection < THE_NB_GEOMETRY_SECTIONS; ++aSection)
+  {
+    aSizes[aSection] = (Standard_Size)aSections[aSection].tellp();
+  }
+  writeGeometrySizes(OS, aSizes);
+  for (Standard_Integer aSection = 0; aSection < THE_NB_GEOMETRY_SECTIONS; ++aSection)
+  {
+    OS << aSections[aSection].rdbuf();
+  }
+}
+
+//=================================================================================================
+
+void BinTools_ShapeSet::writeGeometrySection(const Standard_Integer       theSection,
+                                             Standard_OStream&            theStream,
+                                             const Message_ProgressRange& theRange) const
+{
+  switch (theSection)
+  {
+    case 0:
+      myCurves2d.Write(theStream, theRange);
+      break;
+    case 1:
+      myCurves.Write(theStream, theRange);
+      break;
+    case 2:
+      WritePolygon3D(theStream, theRange);
+      break;
+    case 3:
+      WritePolygonOnTriangulation(theStream, theRange);
+      break;
+    case 4:
+      mySurfaces.Write(theStream, theRange);
+      break;
+    default:
+      WriteTriangulation(theStream, theRange);
+      break;
+  }
 }
 
 //=================================================================================================
@@ -513,29 +610,112 @@ void BinTools_ShapeSet::ReadSubs(TopoShape&          S,
 
 void BinTools_ShapeSet::ReadGeometry(Standard_IStream& IS, const Message_ProgressRange& theRange)
 {
-
-  Message_ProgressScope aPS(theRange, "Reading geometry", 6);
-  myCurves2d.Read(IS, aPS.Next());
-  if (!aPS.More())
+  Message_ProgressScope aPS(theRange, "Reading geometry", THE_NB_GEOMETRY_SECTIONS);
+  if (FormatNb() < BinTools_FormatVersion_VERSION_5)
+  {
+    for (Standard_Integer aSection = 0; aSection < THE_NB_GEOMETRY_SECTIONS && aPS.More();
+         ++aSection)
+    {
+      readGeometrySection(aSection, IS, aPS.Next());
+    }
     return;
+  }
 
-  myCurves.Read(IS, aPS.Next());
-  if (!aPS.More())
-    return;
+  // the sections are independent: they are loaded into memory and decoded in parallel.
+  // To bound the memory, the section which does not fit into the budget is decoded
+  // directly from the input stream, together with the sections loaded before it.
+  char             aKeyword[255];
+  Standard_Integer aNbSections = 0;
+  IS >> aKeyword >> aNbSections;
+  if (IS.fail() || strcmp(aKeyword, "GeometrySections") || aNbSections != THE_NB_GEOMETRY_SECTIONS)
+  {
+    throw ExceptionBase("BinTools_ShapeSet::Read: Not a table of geometry sections");
+  }
+  Standard_Size aSizes[THE_NB_GEOMETRY_SECTIONS];
+  for (Standard_Integer aSection = 0; aSection < THE_NB_GEOMETRY_SECTIONS; ++aSection)
+  {
+    IS >> aSizes[aSection];
+  }
+  IS.get(); // remove lf
+  if (IS.fail())
+  {
+    throw ExceptionBase("BinTools_ShapeSet::Read: Not a table of geometry sections");
+  }
 
-  ReadPolygon3D(IS, aPS.Next());
-  if (!aPS.More())
-    return;
+  Message_ProgressRange aRanges[THE_NB_GEOMETRY_SECTIONS];
+  for (Standard_Integer aSection = 0; aSection < THE_NB_GEOMETRY_SECTIONS; ++aSection)
+  {
+    aRanges[aSection] = aPS.Next();
+  }
 
-  ReadPolygonOnTriangulation(IS, aPS.Next());
-  if (!aPS.More())
-    return;
+  Handle(NCollection_Buffer) aSections[THE_NB_GEOMETRY_SECTIONS];
+  Standard_Integer           aFirst        = 0;
+  Standard_Size              aBufferedSize = 0;
+  for (Standard_Integer aSection = 0; aSection < THE_NB_GEOMETRY_SECTIONS; ++aSection)
+  {
+    if (aSizes[aSection] <= THE_MAX_BUFFERED_SECTIONS_SIZE - aBufferedSize)
+    {
+      aSections[aSection] =
+        new NCollection_Buffer(NCollection_BaseAllocator::CommonBaseAllocator(), aSizes[aSection]);
+      if (aSections[aSection]->IsEmpty()
+          || !IS.read((char*)aSections[aSection]->ChangeData(), aSizes[aSection]))
+      {
+        throw ExceptionBase("BinTools_ShapeSet::Read: Truncated geometry section");
+      }
+      aBufferedSize += aSizes[aSection];
+      if (aSection + 1 < THE_NB_GEOMETRY_SECTIONS)
+      {
+        continue;
+      }
+    }
 
-  mySurfaces.Read(IS, aPS.Next());
-  if (!aPS.More())
-    return;
+    // decode the loaded sections, and the current one from the input stream if it is not loaded
+    Parallel1::For(aFirst, aSection + 1, [&](const Standard_Integer theSection) {
+      const Handle(NCollection_Buffer)& aSectionData = aSections[theSection];
+      if (aSectionData.IsNull())
+      {
+        readGeometrySection(theSection, IS, aRanges[theSection]);
+        return;
+      }
+      ArrayStreamBuffer aBuffer((const char*)aSectionData->Data(), aSectionData->Size());
+      Standard_IStream  aStream(&aBuffer);
+      readGeometrySection(theSection, aStream, aRanges[theSection]);
+    });
+    for (; aFirst <= aSection; ++aFirst)
+    {
+      aSections[aFirst].Nullify();
+    }
+    aBufferedSize = 0;
+  }
+}
 
-  ReadTriangulation(IS, aPS.Next());
+//=================================================================================================
+
+void BinTools_ShapeSet::readGeometrySection(const Standard_Integer       theSection,
+                                            Standard_IStream&            theStream,
+                                            const Message_ProgressRange& theRange)
+{
+  switch (theSection)
+  {
+    case 0:
+      myCurves2d.Read(theStream, theRange);
+      break;
+    case 1:
+      myCurves.Read(theStream, theRange);
+      break;
+    case 2:
+      ReadPolygon3D(theStream, theRange);
+      break;
+    case 3:
+      ReadPolygonOnTriangulation(theStream, theRange);
+      break;
+    case 4:
+      mySurfaces.Read(theStream, theRange);
+      break;
+    default:
+      ReadTriangulation(theStream, theRange);
+      break;
+  }
 }
 
 //=================================================================================================
@@ -1423,8 +1603,17 @@ void BinTools_ShapeSet::WriteTriangulation(Standard_OStream&            OS,
          aTriangulationIter <= aNbTriangulations && aPS.More();
          ++aTriangulationIter, aPS.Next())
     {
-      const Handle(MeshTriangulation)& aTriangulation =
-        myTriangulations.FindKey(aTriangulationIter);
+      Handle(MeshTriangulation) aTriangulation = myTriangulations.FindKey(aTriangulationIter);
+      if (!aTriangulation->HasGeometry() && aTriangulation->HasDeferredData())
+      {
+        // the data of deferred triangulation which is not loaded is read temporarily
+        Handle(MeshTriangulation) aLoaded = aTriangulation->DetachedLoadDeferredData();
+        if (aLoaded.IsNull())
+        {
+          throw ExceptionBase("deferred triangulation cannot be loaded");
+        }
+        aTriangulation = aLoaded;
+      }
       Standard_Boolean NeedToWriteNormals = myTriangulations.FindFromIndex(aTriangulationIter);
       const Standard_Integer aNbNodes     = aTriangulation->NbNodes();
       const Standard_Integer aNbTriangles = aTriangulation->NbTriangles();
@@ -99,11 +99,19 @@ public:
 
   //! Writes the geometry of  me  on the stream <OS> in a
   //! binary format that can be read back by Read.
+  //! Starting from BinTools_FormatVersion_VERSION_5, the geometry sections are preceded
+  //! by the table of their sizes, allowing to read them in parallel.
+  //! The sections are written directly to <OS> and the table is filled after them;
+  //! only a stream which cannot be positioned gets the sections buffered in memory.
   Standard_EXPORT virtual void WriteGeometry(
     Standard_OStream&            OS,
     const Message_ProgressRange& theRange = Message_ProgressRange()) const;
 
   //! Reads the geometry of me from the  stream  <IS>.
+  //! Starting from BinTools_FormatVersion_VERSION_5, the geometry sections
+  //! are decoded in parallel, by one thread per section at most (there are six of them).
+  //! At most 64 MiB of sections are loaded into memory at once,
+  //! a larger section is decoded directly from <IS> in parallel with the loaded ones.
   Standard_EXPORT virtual void ReadGeometry(
     Standard_IStream&            IS,
     const Message_ProgressRange& theRange = Message_ProgressRange());
@@ -177,6 +185,18 @@ public:
     Standard_OStream&            OS,
     const Message_ProgressRange& theRange = Message_ProgressRange()) const;
 
+private:
+  //! Writes the geometry section with the index from 0 to 5: 2D curves, 3D curves,
+  //! 3D polygons, polygons on triangulations, surfaces, triangulations.
+  void writeGeometrySection(const Standard_Integer       theSection,
+                            Standard_OStream&            theStream,
+                            const Message_ProgressRange& theRange) const;
+
+  //! Reads the geometry section with the index from 0 to 5, see writeGeometrySection().
+  void readGeometrySection(const Standard_Integer       theSection,
+                           Standard_IStream&            theStream,
+                           const Message_ProgressRange& theRange);
+
 private:
   TopTools_IndexedMapOfShape                     myShapes; ///< index and its shape (started from 1)
   LocationBinarySet                           myLocations;
@@ -20,7 +20,8 @@ const Standard_CString ShapeSetBase::THE_ASCII_VERSIONS[BinTools_FormatVersion_U
    "Open CASCADE Topology V1 (c)",
    "Open CASCADE Topology V2 (c)",
    "Open CASCADE Topology V3 (c)",
-   "Open CASCADE Topology V4, (c) Open Cascade"};
+   "Open CASCADE Topology V4, (c) Open Cascade",
+   "Open CASCADE Topology V5, (c) Open Cascade"};
 
 //=======================================================================
 // function : operator << (Point3d)
@@ -225,8 +225,7 @@ void BinaryShapeWriter::WriteShape(BinaryOutputStream& theStream, const TopoShap
             theStream << (Standard_Byte)2;
             WriteTriangulation(theStream,
                                aTF->Triangulation(),
-                               aTF->Triangulation()->HasNormals()
-                                 && (IsWithNormals() || aTF->Surface().IsNull()));
+                               IsWithNormals() || aTF->Surface().IsNull());
           }
           else
             theStream << (Standard_Byte)1;
@@ -462,30 +461,44 @@ void BinaryShapeWriter::WriteTriangulation(BinaryOutputStream&                 t
   myTriangulationPos.Bind(theTriangulation, theStream.Position1());
   theStream << BinTools_ObjectType_Triangulation;
 
-  const Standard_Integer aNbNodes     = theTriangulation->NbNodes();
-  const Standard_Integer aNbTriangles = theTriangulation->NbTriangles();
-  theStream << aNbNodes << aNbTriangles << theTriangulation->HasUVNodes();
-  theStream << theNeedToWriteNormals << theTriangulation->Deflection();
+  // the data of deferred triangulation which is not loaded is read temporarily
+  Handle(MeshTriangulation) aData = theTriangulation;
+  if (!aData->HasGeometry() && aData->HasDeferredData())
+  {
+    Handle(MeshTriangulation) aLoaded = aData->DetachedLoadDeferredData();
+    if (aLoaded.IsNull())
+    {
+      // storing an empty mesh instead would lose the triangulation silently
+      throw ExceptionBase("BinTools_ShapeWriter: deferred triangulation cannot be loaded");
+    }
+    aData = aLoaded;
+  }
+
+  const Standard_Integer aNbNodes       = aData->NbNodes();
+  const Standard_Integer aNbTriangles   = aData->NbTriangles();
+  const Standard_Boolean toWriteNormals = theNeedToWriteNormals && aData->HasNormals();
+  theStream << aNbNodes << aNbTriangles << aData->HasUVNodes();
+  theStream << toWriteNormals << aData->Deflection();
   // write the 3d nodes
   for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-    theStream << theTriangulation->Node(aNodeIter);
+    theStream << aData->Node(aNodeIter);
   // theStream.write ((char*)(theTriangulation->InternalNodes().value(0)) , sizeof (Point3d) *
   // aNbNodes);
 
-  if (theTriangulation->HasUVNodes())
+  if (aData->HasUVNodes())
   {
     for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-      theStream << theTriangulation->UVNode(aNodeIter);
+      theStream << aData->UVNode(aNodeIter);
   }
   for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
-    theStream << theTriangulation->Triangle1(aTriIter);
+    theStream << aData->Triangle1(aTriIter);
 
-  if (theNeedToWriteNormals)
+  if (toWriteNormals)
   {
     gp_Vec3f aNormal;
     for (Standard_Integer aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
     {
-      theTriangulation->Normal(aNormalIter, aNormal);
+      aData->Normal(aNormalIter, aNormal);
       theStream << aNormal;
     }
   }
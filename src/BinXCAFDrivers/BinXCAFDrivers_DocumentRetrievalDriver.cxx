@@ -14,6 +14,7 @@
 // commercial license or contractual agreement.
 
 #include <BinMDF_ADriverTable.hxx>
+#include <BinMXCAFDoc.hxx>
 #include <BinXCAFDrivers.hxx>
 #include <BinXCAFDrivers_DocumentRetrievalDriver.hxx>
 #include <Message_Messenger.hxx>
@@ -33,3 +34,16 @@ Handle(AttributeDriverTable) BinXCAFDrivers_DocumentRetrievalDriver::AttributeDr
 {
   return BinXCAFDrivers1::AttributeDrivers(theMsgDriver);
 }
+
+//=================================================================================================
+
+Handle(PCDM_RetrievalDriver) BinXCAFDrivers_DocumentRetrievalDriver::Copy() const
+{
+  Handle(BinXCAFDrivers_DocumentRetrievalDriver) aCopy = new BinXCAFDrivers_DocumentRetrievalDriver();
+  if (!InitCopy(aCopy)
+      || (!aCopy->myDrivers.IsNull() && !BinMXCAFDoc1::RelinkLocationDriver(aCopy->myDrivers)))
+  {
+    return Handle(PCDM_RetrievalDriver)();
+  }
+  return aCopy;
+}
@@ -14,6 +14,7 @@
 // commercial license or contractual agreement.
 
 #include <BinMDF_ADriverTable.hxx>
+#include <BinMXCAFDoc.hxx>
 #include <BinXCAFDrivers.hxx>
 #include <BinXCAFDrivers_DocumentStorageDriver.hxx>
 #include <Message_Messenger.hxx>
@@ -32,3 +33,16 @@ Handle(AttributeDriverTable) BinXCAFDrivers_DocumentStorageDriver::AttributeDriv
 {
   return BinXCAFDrivers1::AttributeDrivers(theMsgDriver);
 }
+
+//=================================================================================================
+
+Handle(PCDM_StorageDriver) BinXCAFDrivers_DocumentStorageDriver::Copy() const
+{
+  Handle(BinXCAFDrivers_DocumentStorageDriver) aCopy = new BinXCAFDrivers_DocumentStorageDriver();
+  if (!InitCopy(aCopy)
+      || (!aCopy->myDrivers.IsNull() && !BinMXCAFDoc1::RelinkLocationDriver(aCopy->myDrivers)))
+  {
+    return Handle(PCDM_StorageDriver)();
+  }
+  return aCopy;
+}
@@ -18,6 +18,7 @@
 
 #include <CDF_Application.hxx>
 #include <CDF_Directory.hxx>
+#include <CDF_DriverSentry.hxx>
 #include <CDF_FWOSDriver.hxx>
 #include <CDM_CanCloseStatus.hxx>
 #include <CDM_Document.hxx>
@@ -66,6 +67,7 @@ void CDF_Application::InitDocument(const Handle(CDM_Document)& /*theDoc*/) const
 
 void CDF_Application::Open(const Handle(CDM_Document)& aDocument)
 {
+  Standard_Mutex::Sentry aLock(myMutex);
   myDirectory->Add(aDocument);
   aDocument->Open(this);
   Activate(aDocument, CDF_TOA_New);
@@ -82,6 +84,7 @@ CDM_CanCloseStatus CDF_Application::CanClose(const Handle(CDM_Document)& aDocume
 
 void CDF_Application::Close(const Handle(CDM_Document)& aDocument)
 {
+  Standard_Mutex::Sentry aLock(myMutex);
   myDirectory->Remove(aDocument);
   aDocument->Close();
 }
@@ -107,17 +110,48 @@ Handle(CDM_Document) CDF_Application::Retrieve(const UtfString& aFolder,
                                                const Handle(ReaderFilter)& theFilter,
                                                const Message_ProgressRange&     theRange)
 {
-  Handle(CDM_MetaData) theMetaData;
+  PCDM_ReaderStatus    aStatus = PCDM_RS_DriverFailure;
+  Handle(CDM_Document) aDocument;
+  try
+  {
+    aDocument =
+      Retrieve(aFolder, aName, aVersion, aStatus, UseStorageConfiguration, theFilter, theRange);
+  }
+  catch (ExceptionBase const&)
+  {
+    SetRetrieveStatus(aStatus);
+    throw;
+  }
+  SetRetrieveStatus(aStatus);
+  return aDocument;
+}
 
-  if (aVersion.Length() == 0)
-    theMetaData = myMetaDataDriver->MetaData(aFolder, aName);
-  else
-    theMetaData = myMetaDataDriver->MetaData(aFolder, aName, aVersion);
+//=================================================================================================
 
-  CDF_TypeOfActivation theTypeOfActivation = TypeOfActivation(theMetaData);
+Handle(CDM_Document) CDF_Application::Retrieve(const UtfString& aFolder,
+                                               const UtfString& aName,
+                                               const UtfString& aVersion,
+                                               PCDM_ReaderStatus&                theStatus,
+                                               const Standard_Boolean UseStorageConfiguration,
+                                               const Handle(ReaderFilter)& theFilter,
+                                               const Message_ProgressRange&     theRange)
+{
+  theStatus = PCDM_RS_DriverFailure;
+  Handle(CDM_MetaData)  theMetaData;
+  CDF_TypeOfActivation theTypeOfActivation;
+  {
+    Standard_Mutex::Sentry aLock(myMutex);
+    if (aVersion.Length() == 0)
+      theMetaData = myMetaDataDriver->MetaData(aFolder, aName);
+    else
+      theMetaData = myMetaDataDriver->MetaData(aFolder, aName, aVersion);
+
+    theTypeOfActivation = TypeOfActivation(theMetaData);
+  }
   Handle(CDM_Document) theDocument =
-    Retrieve(theMetaData, UseStorageConfiguration, Standard_False, theFilter, theRange);
+    Retrieve(theMetaData, UseStorageConfiguration, Standard_False, theStatus, theFilter, theRange);
 
+  Standard_Mutex::Sentry aLock(myMutex);
   myDirectory->Add(theDocument);
   Activate(theDocument, theTypeOfActivation);
 
@@ -142,6 +176,7 @@ PCDM_ReaderStatus CDF_Application::CanRetrieve(const UtfString& theFolder,
                                                const UtfString& theVersion,
                                                const bool                        theAppendMode)
 {
+  Standard_Mutex::Sentry aLock(myMutex);
 
   if (!myMetaDataDriver->Find(theFolder, theName, theVersion))
     return PCDM_RS_UnknownDocument;
@@ -202,6 +237,7 @@ void CDF_Application::Activate(const Handle(CDM_Document)&, const CDF_TypeOfActi
 
 Standard_ExtString CDF_Application::DefaultFolder()
 {
+  Standard_Mutex::Sentry aLock(myMutex);
   if (myDefaultFolder.Length() == 0)
   {
     myDefaultFolder = myMetaDataDriver->DefaultFolder();
@@ -213,6 +249,7 @@ Standard_ExtString CDF_Application::DefaultFolder()
 
 Standard_Boolean CDF_Application::SetDefaultFolder(const Standard_ExtString aFolder)
 {
+  Standard_Mutex::Sentry aLock(myMutex);
   Standard_Boolean found = myMetaDataDriver->FindFolder(aFolder);
   if (found)
     myDefaultFolder = aFolder;
@@ -226,7 +263,20 @@ Handle(CDM_Document) CDF_Application::Retrieve(const Handle(CDM_MetaData)& aMeta
                                                const Handle(ReaderFilter)& theFilter,
                                                const Message_ProgressRange&     theRange)
 {
-  return Retrieve(aMetaData, UseStorageConfiguration, Standard_True, theFilter, theRange);
+  PCDM_ReaderStatus    aStatus = PCDM_RS_DriverFailure;
+  Handle(CDM_Document) aDocument;
+  try
+  {
+    aDocument =
+      Retrieve(aMetaData, UseStorageConfiguration, Standard_True, aStatus, theFilter, theRange);
+  }
+  catch (ExceptionBase const&)
+  {
+    SetRetrieveStatus(aStatus);
+    throw;
+  }
+  SetRetrieveStatus(aStatus);
+  return aDocument;
 }
 
 //=================================================================================================
@@ -234,45 +284,57 @@ Handle(CDM_Document) CDF_Application::Retrieve(const Handle(CDM_MetaData)& aMeta
 Handle(CDM_Document) CDF_Application::Retrieve(const Handle(CDM_MetaData)& aMetaData,
                                                const Standard_Boolean      UseStorageConfiguration,
                                                const Standard_Boolean      IsComponent,
+                                               PCDM_ReaderStatus&          theStatus,
                                                const Handle(ReaderFilter)& theFilter,
                                                const Message_ProgressRange&     theRange)
 {
 
-  Handle(CDM_Document) theDocumentToReturn;
-  myRetrievableStatus           = PCDM_RS_DriverFailure;
+  theStatus                     = PCDM_RS_DriverFailure;
   Standard_Boolean isAppendMode = !theFilter.IsNull() && theFilter->IsAppendMode();
-  if (IsComponent)
+
+  // the same file is not read by two threads at once,
+  // the next one finds the document retrieved by the first one
+  RetrievalSentry aFileSentry(*this, aMetaData);
+
+  // the meta-data and the session are accessed under the lock of the application,
+  // while the document itself is read outside of it
+  Handle(Reader1)      theReader;
+  Handle(CDM_Document) aDocument;
   {
-    Standard_SStream aMsg;
-    myRetrievableStatus = CanRetrieve(aMetaData, isAppendMode);
-    switch (myRetrievableStatus)
+    Standard_Mutex::Sentry aLock(myMutex);
+    if (IsComponent)
     {
-      case PCDM_RS_UnknownDocument:
-        aMsg << "could not find the referenced document: " << aMetaData->Path() << "; not found."
-             << (char)0 << std::endl;
-        break;
-      case PCDM_RS_PermissionDenied:
-        aMsg << "Could not find the referenced document: " << aMetaData->Path()
-             << "; permission denied. " << (char)0 << std::endl;
-        break;
-      case PCDM_RS_NoDocument:
-        aMsg << "Document for appending is not defined." << (char)0 << std::endl;
-        break;
-      default:
-        myRetrievableStatus = PCDM_RS_OK;
+      Standard_SStream aMsg;
+      theStatus = CanRetrieve(aMetaData, isAppendMode);
+      switch (theStatus)
+      {
+        case PCDM_RS_UnknownDocument:
+          aMsg << "could not find the referenced document: " << aMetaData->Path()
+               << "; not found." << (char)0 << std::endl;
+          break;
+        case PCDM_RS_PermissionDenied:
+          aMsg << "Could not find the referenced document: " << aMetaData->Path()
+               << "; permission denied. " << (char)0 << std::endl;
+          break;
+        case PCDM_RS_NoDocument:
+          aMsg << "Document for appending is not defined." << (char)0 << std::endl;
+          break;
+        default:
+          theStatus = PCDM_RS_OK;
+      }
+      if (theStatus != PCDM_RS_OK)
+        throw ExceptionBase(aMsg.str().c_str());
+      theStatus = PCDM_RS_DriverFailure;
     }
-    if (myRetrievableStatus != PCDM_RS_OK)
-      throw ExceptionBase(aMsg.str().c_str());
-    myRetrievableStatus = PCDM_RS_DriverFailure;
-  }
-  Standard_Boolean AlreadyRetrieved = aMetaData->IsRetrieved();
-  if (AlreadyRetrieved)
-    myRetrievableStatus = PCDM_RS_AlreadyRetrieved;
-  Standard_Boolean Modified = AlreadyRetrieved && aMetaData->Document()->IsModified();
-  if (Modified)
-    myRetrievableStatus = PCDM_RS_AlreadyRetrievedAndModified;
-  if (!AlreadyRetrieved || Modified || isAppendMode)
-  {
+    Standard_Boolean AlreadyRetrieved = aMetaData->IsRetrieved();
+    if (AlreadyRetrieved)
+      theStatus = PCDM_RS_AlreadyRetrieved;
+    Standard_Boolean Modified = AlreadyRetrieved && aMetaData->Document()->IsModified();
+    if (Modified)
+      theStatus = PCDM_RS_AlreadyRetrievedAndModified;
+    if (AlreadyRetrieved && !Modified && !isAppendMode)
+      return aMetaData->Document();
+
     UtfString aFormat;
     if (!Format(aMetaData->FileName(), aFormat))
     {
@@ -280,9 +342,19 @@ Handle(CDM_Document) CDF_Application::Retrieve(const Handle(CDM_MetaData)& aMeta
       aMsg << "Could not determine format for the file " << aMetaData->FileName() << (char)0;
       throw Standard_NoSuchObject(aMsg.str().c_str());
     }
-    Handle(Reader1) theReader = ReaderFromFormat(aFormat);
-
-    Handle(CDM_Document) aDocument;
+    // ReaderFromFormat() reports its failure by myRetrievableStatus,
+    // which is not changed by other threads while the lock is held
+    myRetrievableStatus = theStatus;
+    try
+    {
+      theReader = ReaderFromFormat(aFormat);
+    }
+    catch (ExceptionBase const&)
+    {
+      theStatus = myRetrievableStatus;
+      throw;
+    }
+    theStatus = myRetrievableStatus;
 
     if (Modified || isAppendMode)
     {
@@ -300,35 +372,37 @@ Handle(CDM_Document) CDF_Application::Retrieve(const Handle(CDM_MetaData)& aMeta
       myMetaDataDriver->ReferenceIterator(MessageDriver())
         ->LoadReferences(aDocument, aMetaData, this, UseStorageConfiguration);
     }
+  }
 
-    try
-    {
-      OCC_CATCH_SIGNALS
-      theReader->Read(aMetaData->FileName(), aDocument, this, theFilter, theRange);
-    }
-    catch (ExceptionBase const& anException)
-    {
-      myRetrievableStatus = theReader->GetStatus();
-      if (myRetrievableStatus > PCDM_RS_AlreadyRetrieved)
-      {
-        Standard_SStream aMsg;
-        aMsg << anException << std::endl;
-        throw ExceptionBase(aMsg.str().c_str());
-      }
-    }
-    myRetrievableStatus = theReader->GetStatus();
-    if (!isAppendMode)
+  // use the shared driver, or its copy if the driver is busy with another document
+  Handle(PCDM_RetrievalDriver)           aDriver = Handle(PCDM_RetrievalDriver)::DownCast(theReader);
+  CDF_DriverSentry<PCDM_RetrievalDriver> aDriverSentry(aDriver);
+  if (!aDriver.IsNull())
+    theReader = aDriverSentry.Driver();
+
+  try
+  {
+    OCC_CATCH_SIGNALS
+    theReader->Read(aMetaData->FileName(), aDocument, this, theFilter, theRange);
+  }
+  catch (ExceptionBase const& anException)
+  {
+    theStatus = theReader->GetStatus();
+    if (theStatus > PCDM_RS_AlreadyRetrieved)
     {
-      aDocument->Open(this); // must be done before SetMetaData
-      aDocument->SetMetaData(aMetaData);
+      Standard_SStream aMsg;
+      aMsg << anException << std::endl;
+      throw ExceptionBase(aMsg.str().c_str());
     }
-
-    theDocumentToReturn = aDocument;
   }
-  else
-    theDocumentToReturn = aMetaData->Document();
-
-  return theDocumentToReturn;
+  theStatus = theReader->GetStatus();
+  if (!isAppendMode)
+  {
+    Standard_Mutex::Sentry aLock(myMutex);
+    aDocument->Open(this); // must be done before SetMetaData
+    aDocument->SetMetaData(aMetaData);
+  }
+  return aDocument;
 }
 
 //=================================================================================================
@@ -368,6 +442,28 @@ void CDF_Application::Read(Standard_IStream&                theIStream,
                            const Handle(ReaderFilter)& theFilter,
                            const Message_ProgressRange&     theRange)
 {
+  PCDM_ReaderStatus aStatus = PCDM_RS_DriverFailure;
+  try
+  {
+    Read(theIStream, theDocument, aStatus, theFilter, theRange);
+  }
+  catch (ExceptionBase const&)
+  {
+    SetRetrieveStatus(aStatus);
+    throw;
+  }
+  SetRetrieveStatus(aStatus);
+}
+
+//=================================================================================================
+
+void CDF_Application::Read(Standard_IStream&                theIStream,
+                           Handle(CDM_Document)&            theDocument,
+                           PCDM_ReaderStatus&               theStatus,
+                           const Handle(ReaderFilter)& theFilter,
+                           const Message_ProgressRange&     theRange)
+{
+  theStatus = PCDM_RS_DriverFailure;
   Handle(Storage_Data) dData;
 
   UtfString aFormat;
@@ -380,7 +476,7 @@ void CDF_Application::Read(Standard_IStream&                theIStream,
   }
   catch (ExceptionBase const& anException)
   {
-    myRetrievableStatus = PCDM_RS_FormatFailure;
+    theStatus = PCDM_RS_FormatFailure;
 
     Standard_SStream aMsg;
     aMsg << anException << std::endl;
@@ -389,12 +485,26 @@ void CDF_Application::Read(Standard_IStream&                theIStream,
 
   if (aFormat.IsEmpty())
   {
-    myRetrievableStatus = PCDM_RS_FormatFailure;
+    theStatus = PCDM_RS_FormatFailure;
     return;
   }
 
   // use a format name to detect plugin corresponding to the format to continue reading
-  Handle(Reader1) aReader = ReaderFromFormat(aFormat);
+  Handle(Reader1) aReader;
+  {
+    Standard_Mutex::Sentry aLock(myMutex);
+    myRetrievableStatus = theStatus;
+    try
+    {
+      aReader = ReaderFromFormat(aFormat);
+    }
+    catch (ExceptionBase const&)
+    {
+      theStatus = myRetrievableStatus;
+      throw;
+    }
+    theStatus = myRetrievableStatus;
+  }
 
   if (theFilter.IsNull() || !theFilter->IsAppendMode())
   {
@@ -405,17 +515,23 @@ void CDF_Application::Read(Standard_IStream&                theIStream,
     // check the document is ready to append
     if (theDocument.IsNull())
     {
-      myRetrievableStatus = PCDM_RS_NoDocument;
+      theStatus = PCDM_RS_NoDocument;
       return;
     }
     // check document format equals to the format of the stream
     if (theDocument->StorageFormat() != aFormat)
     {
-      myRetrievableStatus = PCDM_RS_FormatFailure;
+      theStatus = PCDM_RS_FormatFailure;
       return;
     }
   }
 
+  // use the shared driver, or its copy if the driver is busy with another document
+  Handle(PCDM_RetrievalDriver)           aDriver = Handle(PCDM_RetrievalDriver)::DownCast(aReader);
+  CDF_DriverSentry<PCDM_RetrievalDriver> aDriverSentry(aDriver);
+  if (!aDriver.IsNull())
+    aReader = aDriverSentry.Driver();
+
   // read the content of theIStream to aDoc
   try
   {
@@ -424,8 +540,8 @@ void CDF_Application::Read(Standard_IStream&                theIStream,
   }
   catch (ExceptionBase const& anException)
   {
-    myRetrievableStatus = aReader->GetStatus();
-    if (myRetrievableStatus > PCDM_RS_AlreadyRetrieved)
+    theStatus = aReader->GetStatus();
+    if (theStatus > PCDM_RS_AlreadyRetrieved)
     {
       Standard_SStream aMsg;
       aMsg << anException << std::endl;
@@ -433,13 +549,15 @@ void CDF_Application::Read(Standard_IStream&                theIStream,
     }
   }
 
-  myRetrievableStatus = aReader->GetStatus();
+  theStatus = aReader->GetStatus();
 }
 
 //=================================================================================================
 
 Handle(Reader1) CDF_Application::ReaderFromFormat(const UtfString& theFormat)
 {
+  Standard_Mutex::Sentry aLock(myMutex);
+
   // check map of readers
   Handle(PCDM_RetrievalDriver) aReader;
   if (myReaders.FindFromKey(theFormat, aReader))
@@ -495,6 +613,8 @@ Handle(Reader1) CDF_Application::ReaderFromFormat(const UtfString& theFormat)
 Handle(PCDM_StorageDriver) CDF_Application::WriterFromFormat(
   const UtfString& theFormat)
 {
+  Standard_Mutex::Sentry aLock(myMutex);
+
   // check map of writers
   Handle(PCDM_StorageDriver) aDriver;
   if (myWriters.FindFromKey(theFormat, aDriver))
@@ -551,6 +671,7 @@ Handle(PCDM_StorageDriver) CDF_Application::WriterFromFormat(
 Standard_Boolean CDF_Application::Format(const UtfString& aFileName,
                                          UtfString&       theFormat)
 {
+  Standard_Mutex::Sentry aLock(myMutex);
 
   theFormat = ReadWriter::FileFormat(aFileName);
   // It is good if the format is in the file. Otherwise base on the extension.
@@ -583,6 +704,14 @@ PCDM_ReaderStatus CDF_Application::CanRetrieve(const Handle(CDM_MetaData)& aMeta
 
 //=================================================================================================
 
+void CDF_Application::SetRetrieveStatus(const PCDM_ReaderStatus theStatus)
+{
+  Standard_Mutex::Sentry aLock(myMutex);
+  myRetrievableStatus = theStatus;
+}
+
+//=================================================================================================
+
 Handle(CDF_MetaDataDriver) CDF_Application::MetaDataDriver() const
 {
   Standard_NoSuchObject_Raise_if(myMetaDataDriver.IsNull(),
@@ -590,3 +719,68 @@ Handle(CDF_MetaDataDriver) CDF_Application::MetaDataDriver() const
                                  "able to store or retrieve files.");
   return myMetaDataDriver;
 }
+
+//=================================================================================================
+
+CDF_Application::RetrievalSentry::RetrievalSentry(CDF_Application&            theApplication,
+                                                  const Handle(CDM_MetaData)& theMetaData)
+    : myApplication(theApplication)
+{
+  reserve(theMetaData);
+}
+
+//=================================================================================================
+
+CDF_Application::RetrievalSentry::RetrievalSentry(CDF_Application& theApplication,
+                                                  const UtfString& theFolder,
+                                                  const UtfString& theName)
+    : myApplication(theApplication)
+{
+  Handle(CDM_MetaData) aMetaData;
+  {
+    Standard_Mutex::Sentry aLock(theApplication.myMutex);
+    if (theApplication.myMetaDataDriver->Find(theFolder, theName))
+      aMetaData = theApplication.myMetaDataDriver->MetaData(theFolder, theName);
+  }
+  reserve(aMetaData);
+}
+
+//=================================================================================================
+
+CDF_Application::RetrievalSentry::~RetrievalSentry()
+{
+  if (myFileMutex.IsNull())
+    return;
+
+  myFileMutex->Unlock();
+  Standard_Mutex::Sentry aLock(myApplication.myMutex);
+  RetrievalLock&         aFileLock = myApplication.myRetrievals.ChangeFind(myMetaData);
+  if (--aFileLock.NbSentries == 0)
+    myApplication.myRetrievals.UnBind(myMetaData);
+}
+
+//=================================================================================================
+
+void CDF_Application::RetrievalSentry::reserve(const Handle(CDM_MetaData)& theMetaData)
+{
+  if (theMetaData.IsNull())
+    return;
+
+  {
+    // the meta-data is the same object for all the retrievals of the same file
+    Standard_Mutex::Sentry aLock(myApplication.myMutex);
+    RetrievalLock*         aFileLock = myApplication.myRetrievals.ChangeSeek(theMetaData);
+    if (aFileLock == NULL)
+    {
+      RetrievalLock aNewLock;
+      aNewLock.Mutex      = new Standard_HMutex();
+      aNewLock.NbSentries = 0;
+      aFileLock           = myApplication.myRetrievals.Bound(theMetaData, aNewLock);
+    }
+    ++aFileLock->NbSentries;
+    myMetaData  = theMetaData;
+    myFileMutex = aFileLock->Mutex;
+  }
+  // the file is locked out of the lock of the application, which is taken by the retrieval
+  myFileMutex->Lock();
+}
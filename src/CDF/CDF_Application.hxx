@@ -24,7 +24,9 @@
 #include <CDM_Application.hxx>
 #include <CDM_CanCloseStatus.hxx>
 #include <Standard_IStream.hxx>
+#include <NCollection_DataMap.hxx>
 #include <NCollection_IndexedDataMap.hxx>
+#include <Standard_Mutex.hxx>
 
 class Standard_GUID;
 class CDM_Document;
@@ -123,6 +125,19 @@ public:
     const Handle(ReaderFilter)&  theFilter               = Handle(ReaderFilter)(),
     const Message_ProgressRange&      theRange                = Message_ProgressRange());
 
+  //! Retrieves a document from the database as the method above,
+  //! and returns the status of this retrieval in theStatus.
+  //! Unlike GetRetrieveStatus(), the returned status is not affected by
+  //! retrievals performed concurrently by other threads using this application.
+  Standard_EXPORT Handle(CDM_Document) Retrieve(
+    const UtfString& aFolder,
+    const UtfString& aName,
+    const UtfString& aVersion,
+    PCDM_ReaderStatus&                theStatus,
+    const Standard_Boolean            UseStorageConfiguration = Standard_True,
+    const Handle(ReaderFilter)&  theFilter               = Handle(ReaderFilter)(),
+    const Message_ProgressRange&      theRange                = Message_ProgressRange());
+
   Standard_EXPORT PCDM_ReaderStatus CanRetrieve(const UtfString& theFolder,
                                                 const UtfString& theName,
                                                 const bool                        theAppendMode);
@@ -132,7 +147,9 @@ public:
                                                 const UtfString& theVersion,
                                                 const bool                        theAppendMode);
 
-  //! Checks  status  after  Retrieve
+  //! Checks  status  after  Retrieve.
+  //! When documents are retrieved concurrently by several threads, the overloads
+  //! of Retrieve() and Read() returning the status of the call should be used instead.
   PCDM_ReaderStatus GetRetrieveStatus() const { return myRetrievableStatus; }
 
   //! Reads theDocument from standard SEEKABLE stream theIStream,
@@ -143,6 +160,15 @@ public:
     const Handle(ReaderFilter)& theFilter = Handle(ReaderFilter)(),
     const Message_ProgressRange&     theRange  = Message_ProgressRange());
 
+  //! Reads theDocument from standard SEEKABLE stream theIStream as the method above,
+  //! and returns the status of this reading in theStatus.
+  Standard_EXPORT void Read(
+    Standard_IStream&                theIStream,
+    Handle(CDM_Document)&            theDocument,
+    PCDM_ReaderStatus&               theStatus,
+    const Handle(ReaderFilter)& theFilter = Handle(ReaderFilter)(),
+    const Message_ProgressRange&     theRange  = Message_ProgressRange());
+
   //! Returns instance of read driver for specified format.
   //!
   //! Default implementation uses plugin mechanism to load reader dynamically.
@@ -186,6 +212,12 @@ public:
   //! returns MetaDatdDriver of this application
   Standard_EXPORT Handle(CDF_MetaDataDriver) MetaDataDriver() const;
 
+  //! Returns the mutex guarding the session directory, the maps of drivers
+  //! and the meta-data of this application. It is locked internally by
+  //! Open(), Close(), Retrieve() and the driver look-up, while the reading
+  //! and writing of document contents is performed outside of it.
+  Standard_Mutex& Mutex() const { return myMutex; }
+
   DEFINE_STANDARD_RTTIEXT(CDF_Application, CDM_Application)
 
   Handle(CDF_MetaDataDriver) myMetaDataDriver;
@@ -218,6 +250,7 @@ private:
     const Handle(CDM_MetaData)&      aMetaData,
     const Standard_Boolean           UseStorageConfiguration,
     const Standard_Boolean           IsComponent,
+    PCDM_ReaderStatus&               theStatus,
     const Handle(ReaderFilter)& theFilter = Handle(ReaderFilter)(),
     const Message_ProgressRange&     theRange  = Message_ProgressRange());
 
@@ -229,15 +262,62 @@ private:
   Standard_EXPORT PCDM_ReaderStatus CanRetrieve(const Handle(CDM_MetaData)& aMetaData,
                                                 const bool                  theAppendMode);
 
+protected:
+  //! Reserves the file of a document for its retrieval by the calling thread
+  //! during the lifetime of the sentry: another thread retrieving the same file
+  //! waits for the end of the retrieval and then finds the document retrieved.
+  //! The same thread can reserve the same file several times.
+  class RetrievalSentry
+  {
+  public:
+    //! Reserves the file of the meta-data.
+    Standard_EXPORT RetrievalSentry(CDF_Application&            theApplication,
+                                    const Handle(CDM_MetaData)& theMetaData);
+
+    //! Reserves the file of the document with the name in the folder, if it exists.
+    Standard_EXPORT RetrievalSentry(CDF_Application& theApplication,
+                                    const UtfString& theFolder,
+                                    const UtfString& theName);
+
+    //! Releases the file.
+    Standard_EXPORT ~RetrievalSentry();
+
+  private:
+    //! Locks the file of the meta-data.
+    void reserve(const Handle(CDM_MetaData)& theMetaData);
+
+  private:
+    RetrievalSentry(const RetrievalSentry&);
+    RetrievalSentry& operator=(const RetrievalSentry&);
+
+  private:
+    CDF_Application&        myApplication;
+    Handle(CDM_MetaData)    myMetaData;
+    Handle(Standard_HMutex) myFileMutex;
+  };
+
 protected:
   Standard_EXPORT CDF_Application();
 
+  //! Sets the status returned by GetRetrieveStatus().
+  Standard_EXPORT void SetRetrieveStatus(const PCDM_ReaderStatus theStatus);
+
   PCDM_ReaderStatus myRetrievableStatus;
   NCollection_IndexedDataMap<UtfString, Handle(PCDM_RetrievalDriver)> myReaders;
   NCollection_IndexedDataMap<UtfString, Handle(PCDM_StorageDriver)>   myWriters;
 
+private:
+  //! Lock of the file of a document being retrieved.
+  struct RetrievalLock
+  {
+    Handle(Standard_HMutex) Mutex;
+    Standard_Integer        NbSentries; //!< number of sentries reserving the file
+  };
+
 private:
   UtfString myDefaultFolder;
+  mutable Standard_Mutex myMutex;
+  NCollection_DataMap<Handle(CDM_MetaData), RetrievalLock> myRetrievals; //!< files being retrieved
 };
 
 #endif // _CDF_Application_HeaderFile
@@ -0,0 +1,74 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _CDF_DriverSentry_HeaderFile
+#define _CDF_DriverSentry_HeaderFile
+
+#include <Standard_Handle.hxx>
+
+//! Selects the driver (PCDM_RetrievalDriver or PCDM_StorageDriver) for a single
+//! document operation, so that independent documents might be read or written
+//! by several threads using one application.
+//! The shared driver is locked for the lifetime of the sentry; when it is busy with
+//! another thread, its copy is used instead, or the sentry waits for the driver,
+//! if the driver cannot be copied.
+template <class TheDriverType>
+class CDF_DriverSentry
+{
+public:
+  //! Constructor selecting the driver.
+  CDF_DriverSentry(const Handle(TheDriverType)& theDriver)
+      : myDriver(theDriver),
+        myIsLocked(Standard_False)
+  {
+    if (theDriver.IsNull())
+    {
+      return;
+    }
+
+    if (!theDriver->Mutex().TryLock())
+    {
+      // copy is used only if it is of the same type, to avoid losing redefined behavior
+      Handle(TheDriverType) aCopy = theDriver->Copy();
+      if (!aCopy.IsNull() && aCopy->DynamicType() == theDriver->DynamicType())
+      {
+        myDriver = aCopy;
+        return;
+      }
+      theDriver->Mutex().Lock();
+    }
+    myIsLocked = Standard_True;
+  }
+
+  //! Destructor releasing the shared driver.
+  ~CDF_DriverSentry()
+  {
+    if (myIsLocked)
+    {
+      myDriver->Mutex().Unlock();
+    }
+  }
+
+  //! Returns the driver to be used by the operation.
+  const Handle(TheDriverType)& Driver() const { return myDriver; }
+
+private:
+  CDF_DriverSentry(const CDF_DriverSentry&);
+  CDF_DriverSentry& operator=(const CDF_DriverSentry&);
+
+private:
+  Handle(TheDriverType) myDriver;
+  Standard_Boolean      myIsLocked;
+};
+
+#endif // _CDF_DriverSentry_HeaderFile
@@ -15,6 +15,7 @@
 // commercial license or contractual agreement.
 
 #include <CDF_Application.hxx>
+#include <CDF_DriverSentry.hxx>
 #include <CDF_MetaDataDriver.hxx>
 #include <CDF_StoreList.hxx>
 #include <CDM_Document.hxx>
@@ -121,12 +122,24 @@ PCDM_StoreStatus CDF_StoreList::Store(Handle(CDM_MetaData)&        aMetaData,
           }
           else
           {
+            // use the shared driver, or its copy if the driver is busy with another document
+            CDF_DriverSentry<PCDM_StorageDriver> aDriverSentry(aDocumentStorageDriver);
+            aDocumentStorageDriver = aDriverSentry.Driver();
+
             // Reset the store-status.
             // It has sense in multi-threaded access to the storage driver - this way we reset the
             // status for each call.
             aDocumentStorageDriver->SetStoreStatus(PCDM_SS_OK);
 
-            if (!theMetaDataDriver->FindFolder(theDocument->RequestedFolder()))
+            Standard_Boolean isFolderFound = Standard_False;
+            UtfString        theName;
+            {
+              Standard_Mutex::Sentry aLock(anApp->Mutex());
+              isFolderFound = theMetaDataDriver->FindFolder(theDocument->RequestedFolder());
+              if (isFolderFound)
+                theName = theMetaDataDriver->BuildFileName(theDocument);
+            }
+            if (!isFolderFound)
             {
               aStatusAssociatedText = "driver not found; reason: ";
               aStatusAssociatedText += "could not find the active dbunit ";
@@ -135,9 +148,10 @@ PCDM_StoreStatus CDF_StoreList::Store(Handle(CDM_MetaData)&        aMetaData,
             }
             else
             {
-              UtfString theName = theMetaDataDriver->BuildFileName(theDocument);
               aDocumentStorageDriver->Write(theDocument, theName, theRange);
-              status    = aDocumentStorageDriver->GetStoreStatus();
+              status = aDocumentStorageDriver->GetStoreStatus();
+
+              Standard_Mutex::Sentry aLock(anApp->Mutex());
               aMetaData = theMetaDataDriver->CreateMetaData(theDocument, theName);
               theDocument->SetMetaData(aMetaData);
 
@@ -28,7 +28,10 @@
 #include <TDF_ChildIterator.hxx>
 #include <PCDM_ReaderFilter.hxx>
 
+#include <NCollection_Array1.hxx>
+#include <NCollection_Sequence.hxx>
 #include <OSD_FileSystem.hxx>
+#include <OSD_Parallel.hxx>
 #include <TDocStd_PathParser.hxx>
 
 #include <AIS_InteractiveContext.hxx>
@@ -344,6 +347,200 @@ static Standard_Integer DDocStd_SaveAs(DrawInterpreter& di, Standard_Integer nb,
   return 1;
 }
 
+namespace
+{
+//! Functor opening documents by one application within several threads.
+class DDocStd_OpenFunctor
+{
+public:
+  DDocStd_OpenFunctor(const Handle(AppManager)&                theApp,
+                      const NCollection_Array1<UtfString>&     thePaths,
+                      NCollection_Array1<Handle(AppDocument)>& theDocs,
+                      NCollection_Array1<PCDM_ReaderStatus>&   theStatuses)
+      : myApp(theApp),
+        myPaths(&thePaths),
+        myDocs(&theDocs),
+        myStatuses(&theStatuses)
+  {
+  }
+
+  void operator()(const Standard_Integer theIndex) const
+  {
+    myStatuses->ChangeValue(theIndex) =
+      myApp->Open(myPaths->Value(theIndex), myDocs->ChangeValue(theIndex));
+  }
+
+private:
+  Handle(AppManager)                       myApp;
+  const NCollection_Array1<UtfString>*     myPaths;
+  NCollection_Array1<Handle(AppDocument)>* myDocs;
+  NCollection_Array1<PCDM_ReaderStatus>*   myStatuses;
+};
+
+//! Functor saving documents by one application within several threads.
+class DDocStd_SaveFunctor
+{
+public:
+  DDocStd_SaveFunctor(const Handle(AppManager)&                      theApp,
+                      const NCollection_Array1<Handle(AppDocument)>& theDocs,
+                      const NCollection_Array1<UtfString>&           thePaths,
+                      NCollection_Array1<PCDM_StoreStatus>&          theStatuses)
+      : myApp(theApp),
+        myDocs(&theDocs),
+        myPaths(&thePaths),
+        myStatuses(&theStatuses)
+  {
+  }
+
+  void operator()(const Standard_Integer theIndex) const
+  {
+    myStatuses->ChangeValue(theIndex) =
+      myApp->SaveAs(myDocs->Value(theIndex), myPaths->Value(theIndex));
+  }
+
+private:
+  Handle(AppManager)                             myApp;
+  const NCollection_Array1<Handle(AppDocument)>* myDocs;
+  const NCollection_Array1<UtfString>*           myPaths;
+  NCollection_Array1<PCDM_StoreStatus>*          myStatuses;
+};
+} // namespace
+
+//=================================================================================================
+
+static Standard_Integer DDocStd_OpenDocuments(DrawInterpreter& theDI,
+                                              Standard_Integer theNbArgs,
+                                              const char**     theArgVec)
+{
+  Standard_Boolean                   toParallel = Standard_True;
+  NCollection_Sequence<UtfString>    aPaths;
+  NCollection_Sequence<AsciiString1> aNames;
+  for (Standard_Integer anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
+  {
+    AsciiString1 anArgCase(theArgVec[anArgIter]);
+    anArgCase.LowerCase();
+    if (anArgCase == "-parallel" || anArgCase == "-noparallel")
+    {
+      toParallel = Draw1::ParseOnOffNoIterator(theNbArgs, theArgVec, anArgIter);
+    }
+    else if (anArgIter + 1 < theNbArgs)
+    {
+      aPaths.Append(UtfString(theArgVec[anArgIter], Standard_True));
+      aNames.Append(theArgVec[anArgIter + 1]);
+      ++anArgIter;
+    }
+    else
+    {
+      theDI << "Syntax error at '" << theArgVec[anArgIter] << "'";
+      return 1;
+    }
+  }
+  if (aPaths.IsEmpty())
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  Handle(AppManager)                      anApp = DDocStd1::GetApplication();
+  NCollection_Array1<UtfString>           aPathArray(1, aPaths.Length());
+  NCollection_Array1<Handle(AppDocument)> aDocs(1, aPaths.Length());
+  NCollection_Array1<PCDM_ReaderStatus>   aStatuses(1, aPaths.Length());
+  for (Standard_Integer anIndex = 1; anIndex <= aPaths.Length(); ++anIndex)
+  {
+    aPathArray.SetValue(anIndex, aPaths.Value(anIndex));
+    aStatuses.SetValue(anIndex, PCDM_RS_DriverFailure);
+  }
+
+  DDocStd_OpenFunctor aFunctor(anApp, aPathArray, aDocs, aStatuses);
+  Parallel1::For(1, aPaths.Length() + 1, aFunctor, !toParallel);
+
+  // documents are registered in Draw within the main thread
+  Standard_Integer aResult = 0;
+  for (Standard_Integer anIndex = 1; anIndex <= aPaths.Length(); ++anIndex)
+  {
+    const Handle(AppDocument)& aDoc = aDocs.Value(anIndex);
+    if (aStatuses.Value(anIndex) != PCDM_RS_OK || aDoc.IsNull())
+    {
+      theDI << "Error: could not retrieve " << aPaths.Value(anIndex) << " (status "
+            << aStatuses.Value(anIndex) << ")\n";
+      aResult = 1;
+      continue;
+    }
+
+    Handle(DDocStd_DrawDocument) aDrawDoc = new DDocStd_DrawDocument(aDoc);
+    NameAttribute::Set(aDoc->GetData()->Root(), aNames.Value(anIndex).ToCString());
+    Draw1::Set(aNames.Value(anIndex).ToCString(), aDrawDoc);
+  }
+  return aResult;
+}
+
+//=================================================================================================
+
+static Standard_Integer DDocStd_SaveDocuments(DrawInterpreter& theDI,
+                                              Standard_Integer theNbArgs,
+                                              const char**     theArgVec)
+{
+  Standard_Boolean                          toParallel = Standard_True;
+  NCollection_Sequence<Handle(AppDocument)> aDocSeq;
+  NCollection_Sequence<UtfString>           aPaths;
+  for (Standard_Integer anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
+  {
+    AsciiString1 anArgCase(theArgVec[anArgIter]);
+    anArgCase.LowerCase();
+    if (anArgCase == "-parallel" || anArgCase == "-noparallel")
+    {
+      toParallel = Draw1::ParseOnOffNoIterator(theNbArgs, theArgVec, anArgIter);
+    }
+    else if (anArgIter + 1 < theNbArgs)
+    {
+      Handle(AppDocument) aDoc;
+      if (!DDocStd1::GetDocument(theArgVec[anArgIter], aDoc))
+      {
+        return 1;
+      }
+      aDocSeq.Append(aDoc);
+      aPaths.Append(UtfString(theArgVec[anArgIter + 1], Standard_True));
+      ++anArgIter;
+    }
+    else
+    {
+      theDI << "Syntax error at '" << theArgVec[anArgIter] << "'";
+      return 1;
+    }
+  }
+  if (aDocSeq.IsEmpty())
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  Handle(AppManager)                      anApp = DDocStd1::GetApplication();
+  NCollection_Array1<Handle(AppDocument)> aDocs(1, aDocSeq.Length());
+  NCollection_Array1<UtfString>           aPathArray(1, aDocSeq.Length());
+  NCollection_Array1<PCDM_StoreStatus>    aStatuses(1, aDocSeq.Length());
+  for (Standard_Integer anIndex = 1; anIndex <= aDocSeq.Length(); ++anIndex)
+  {
+    aDocs.SetValue(anIndex, aDocSeq.Value(anIndex));
+    aPathArray.SetValue(anIndex, aPaths.Value(anIndex));
+    aStatuses.SetValue(anIndex, PCDM_SS_Failure);
+  }
+
+  DDocStd_SaveFunctor aFunctor(anApp, aDocs, aPathArray, aStatuses);
+  Parallel1::For(1, aDocSeq.Length() + 1, aFunctor, !toParallel);
+
+  Standard_Integer aResult = 0;
+  for (Standard_Integer anIndex = 1; anIndex <= aDocSeq.Length(); ++anIndex)
+  {
+    if (aStatuses.Value(anIndex) != PCDM_SS_OK)
+    {
+      theDI << "Error: could not store " << aPaths.Value(anIndex) << " (status "
+            << aStatuses.Value(anIndex) << ")\n";
+      aResult = 1;
+    }
+  }
+  return aResult;
+}
+
 //=================================================================================================
 
 static Standard_Integer DDocStd_Close(DrawInterpreter& theDI,
@@ -615,6 +812,22 @@ void DDocStd1::ApplicationCommands(DrawInterpreter& theCommands)
 
   theCommands.Add("Save", "Save", __FILE__, DDocStd_Save, g);
 
+  theCommands.Add("OpenDocuments",
+                  "OpenDocuments path1 doc1 [path2 doc2 ...] [-parallel {on|off}]"
+                  "\n\t\t: Opens several documents by the same application."
+                  "\n\t\t:  -parallel Open documents within several threads; TRUE by default.",
+                  __FILE__,
+                  DDocStd_OpenDocuments,
+                  g);
+
+  theCommands.Add("SaveDocuments",
+                  "SaveDocuments doc1 path1 [doc2 path2 ...] [-parallel {on|off}]"
+                  "\n\t\t: Saves several documents by the same application."
+                  "\n\t\t:  -parallel Save documents within several threads; TRUE by default.",
+                  __FILE__,
+                  DDocStd_SaveDocuments,
+                  g);
+
   theCommands.Add(
     "Close",
     "Close the specific document or all documents\n"
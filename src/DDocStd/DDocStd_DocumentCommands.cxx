@@ -15,6 +15,7 @@
 
 #include <DDocStd.hxx>
 
+#include <BinDrivers_DocumentRetrievalDriver.hxx>
 #include <BinDrivers_DocumentStorageDriver.hxx>
 #include <DDF.hxx>
 #include <Draw_Interpretor.hxx>
@@ -207,6 +208,51 @@ static Standard_Integer DDocStd_UndoLimit(DrawInterpreter& di, Standard_Integer
   return 0;
 }
 
+//=================================================================================================
+
+static Standard_Integer DDocStd_UndoMemoryLimit(DrawInterpreter& theDI,
+                                                Standard_Integer theNbArgs,
+                                                const char**     theArgVec)
+{
+  if (theNbArgs < 2)
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  Handle(AppDocument) aDoc;
+  if (!DDocStd1::GetDocument(theArgVec[1], aDoc))
+  {
+    return 1;
+  }
+
+  for (Standard_Integer anArgIter = 2; anArgIter < theNbArgs; ++anArgIter)
+  {
+    AsciiString1 anArgCase(theArgVec[anArgIter]);
+    anArgCase.LowerCase();
+    if (anArgCase == "-compact" || anArgCase == "-nocompact")
+    {
+      aDoc->GetData()->SetCompactDeltas(
+        Draw1::ParseOnOffNoIterator(theNbArgs, theArgVec, anArgIter));
+    }
+    else if (anArgCase.IsRealValue(Standard_True) && anArgCase.RealValue() >= 0.0)
+    {
+      aDoc->SetUndoMemoryLimit((Standard_Size)anArgCase.RealValue());
+    }
+    else
+    {
+      theDI << "Syntax error at '" << theArgVec[anArgIter] << "'";
+      return 1;
+    }
+  }
+
+  // display current values
+  theDI << (Standard_Real)aDoc->UndoMemoryLimit() << " ";
+  theDI << (Standard_Real)aDoc->UndosEstimatedSize() << " ";
+  theDI << (aDoc->GetData()->IsCompactDeltas() ? 1 : 0);
+  return 0;
+}
+
 //=======================================================================
 // function : Undo, Redo
 // purpose  : Undo (DOC)
@@ -507,6 +553,40 @@ static Standard_Integer DDocStd_StoreTriangulation(DrawInterpreter& theDi,
 
 //=================================================================================================
 
+static Standard_Integer DDocStd_DeferTriangulation(DrawInterpreter& theDi,
+                                                   Standard_Integer  theNbArgs,
+                                                   const char**      theArgVec)
+{
+  const Handle(AppManager)&         anApp = DDocStd1::GetApplication();
+  Handle(BinDrivers_DocumentRetrievalDriver) aDriverXCaf =
+    Handle(BinDrivers_DocumentRetrievalDriver)::DownCast(anApp->ReaderFromFormat("BinXCAF"));
+  Handle(BinDrivers_DocumentRetrievalDriver) aDriverOcaf =
+    Handle(BinDrivers_DocumentRetrievalDriver)::DownCast(anApp->ReaderFromFormat("BinOcaf"));
+  if (aDriverXCaf.IsNull() || aDriverOcaf.IsNull())
+  {
+    theDi << "Error: BinXCAF or BinOcaf retrieval formats are not registered\n";
+    return 1;
+  }
+
+  if (theNbArgs == 1)
+  {
+    theDi << (aDriverXCaf->IsDeferredTriangulations() ? "1" : "0");
+    return 0;
+  }
+
+  Standard_Boolean toDefer = Standard_True;
+  if (theNbArgs != 2 || !Draw1::ParseOnOff(theArgVec[1], toDefer))
+  {
+    theDi << "Syntax error at '" << theArgVec[theNbArgs - 1] << "'";
+    return 1;
+  }
+  aDriverXCaf->SetDeferredTriangulations(toDefer);
+  aDriverOcaf->SetDeferredTriangulations(toDefer);
+  return 0;
+}
+
+//=================================================================================================
+
 void DDocStd1::DocumentCommands(DrawInterpreter& theCommands)
 {
 
@@ -536,6 +616,15 @@ void DDocStd1::DocumentCommands(DrawInterpreter& theCommands)
                   DDocStd_StoreTriangulation,
                   g);
 
+  theCommands.Add("DeferTriangulation",
+                  "DeferTriangulation [toDefer={0|1}]"
+                  "\n\t\t: Setup BinXCAF/BinOcaf retrieval drivers to leave triangulation"
+                  "\n\t\t: in the file while opening the document; it is loaded on request"
+                  "\n\t\t: (see trlateload). Prints the current state without arguments.",
+                  __FILE__,
+                  DDocStd_DeferTriangulation,
+                  g);
+
   // XREF
 
   theCommands.Add("Copy", "Copy DOC entry XDOC xentry", __FILE__, DDocStd_Copy, g);
@@ -556,6 +645,15 @@ void DDocStd1::DocumentCommands(DrawInterpreter& theCommands)
                   DDocStd_UndoLimit,
                   g);
 
+  theCommands.Add("UndoMemoryLimit",
+                  "UndoMemoryLimit DOC [bytes] [-compact {on|off}]"
+                  "\n\t\t: Sets the limit on estimated memory of Undos in bytes (0 means no limit)"
+                  "\n\t\t: and compact deltas mode for array attributes."
+                  "\n\t\t: Returns the limit, the estimated memory of Undos and compact deltas mode.",
+                  __FILE__,
+                  DDocStd_UndoMemoryLimit,
+                  g);
+
   theCommands.Add("Undo", "Undo DOC (steps = 1)", __FILE__, DDocStd_Undo, g);
 
   theCommands.Add("Redo", "Redo DOC (steps = 1)", __FILE__, DDocStd_Undo, g);
@@ -1144,6 +1144,8 @@ void Geom_BSplineSurface::UpdateUKnots()
         break;
     }
   }
+
+  ResetCacheTable();
 }
 
 //=================================================================================================
@@ -1197,6 +1199,25 @@ void Geom_BSplineSurface::UpdateVKnots()
         break;
     }
   }
+
+  ResetCacheTable();
+}
+
+//=================================================================================================
+
+void Geom_BSplineSurface::ResetCacheTable()
+{
+  // the table is created when the flat knots in both directions are computed
+  if (ufknots.IsNull() || vfknots.IsNull())
+  {
+    return;
+  }
+  cachetable = new BSplSLib_CacheTable(udeg,
+                                       uperiodic,
+                                       ufknots->Array1(),
+                                       vdeg,
+                                       vperiodic,
+                                       vfknots->Array1());
 }
 
 //=======================================================================
@@ -1270,6 +1291,7 @@ void Geom_BSplineSurface::SetWeight(const Standard_Integer UIndex,
   }
   Weights(UIndex + Weights.LowerRow() - 1, VIndex + Weights.LowerCol() - 1) = Weight;
   Rational(Weights, urational, vrational);
+  ResetCacheTable();
 }
 
 //=================================================================================================
@@ -1299,6 +1321,7 @@ void Geom_BSplineSurface::SetWeightCol(const Standard_Integer      VIndex,
   }
   // Verifie si c'est rationnel
   Rational(Weights, urational, vrational);
+  ResetCacheTable();
 }
 
 //=================================================================================================
@@ -1330,6 +1353,7 @@ void Geom_BSplineSurface::SetWeightRow(const Standard_Integer      UIndex,
   }
   // Verifie si c'est rationnel
   Rational(Weights, urational, vrational);
+  ResetCacheTable();
 }
 
 //=================================================================================================
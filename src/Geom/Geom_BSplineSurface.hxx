@@ -29,6 +29,7 @@
 #include <TColStd_HArray1OfReal.hxx>
 #include <TColStd_HArray1OfInteger.hxx>
 #include <Geom_BoundedSurface.hxx>
+#include <BSplSLib_CacheTable.hxx>
 #include <TColgp_Array2OfPnt.hxx>
 #include <TColStd_Array1OfReal.hxx>
 #include <TColStd_Array1OfInteger.hxx>
@@ -1102,6 +1103,19 @@ public:
   //! value and derivatives computation
   Standard_EXPORT const TColStd_Array2OfReal* Weights() const;
 
+  //! Returns the cache of the polynomial span containing the point (U, V).
+  //! The caches of the spans are calculated on demand and shared
+  //! by all evaluators of the surface, including those working in
+  //! other threads; the returned cache must not be rebuilt.
+  //! The caches are dropped on any modification of the surface.
+  Standard_EXPORT Handle(BSplSLib_Cache) SpanCache(const Standard_Real U,
+                                                   const Standard_Real V) const;
+
+  //! Returns the table of caches of the spans used by SpanCache(),
+  //! e.g. to change the number of caches kept for the surface.
+  //! The table is replaced by a new one on any modification of the surface.
+  const Handle(BSplSLib_CacheTable)& SpanCacheTable() const { return cachetable; }
+
   Standard_EXPORT void D0(const Standard_Real U,
                           const Standard_Real V,
                           Point3d&             P) const Standard_OVERRIDE;
@@ -1323,6 +1337,10 @@ private:
   //! continuity for V.
   Standard_EXPORT void UpdateVKnots();
 
+  //! Replaces the table of span caches by an empty one
+  //! corresponding to the current knots.
+  Standard_EXPORT void ResetCacheTable();
+
   Standard_Boolean                 urational;
   Standard_Boolean                 vrational;
   Standard_Boolean                 uperiodic;
@@ -1344,6 +1362,7 @@ private:
   Standard_Real                    umaxderivinv;
   Standard_Real                    vmaxderivinv;
   Standard_Boolean                 maxderivinvok;
+  Handle(BSplSLib_CacheTable)      cachetable;
 };
 
 #endif // _Geom_BSplineSurface_HeaderFile
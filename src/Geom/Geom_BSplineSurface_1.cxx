@@ -909,6 +909,14 @@ const TColStd_Array2OfReal* Geom_BSplineSurface::Weights() const
 
 //=================================================================================================
 
+Handle(BSplSLib_Cache) Geom_BSplineSurface::SpanCache(const Standard_Real U,
+                                                      const Standard_Real V) const
+{
+  return cachetable->Cache(U, V, ufknots->Array1(), vfknots->Array1(), poles->Array2(), Weights());
+}
+
+//=================================================================================================
+
 void Geom_BSplineSurface::Transform(const Transform3d& T)
 {
   TColgp_Array2OfPnt& VPoles = poles->ChangeArray2();
@@ -919,6 +927,7 @@ void Geom_BSplineSurface::Transform(const Transform3d& T)
       VPoles(i, j).Transform(T);
     }
   }
+  ResetCacheTable();
 }
 
 //=================================================================================================
@@ -1640,6 +1649,7 @@ void Geom_BSplineSurface::SetPoleCol(const Standard_Integer    VIndex,
   {
     Poles(I + Poles.LowerRow() - 1, VIndex + Poles.LowerCol() - 1) = CPoles(I);
   }
+  ResetCacheTable();
 }
 
 //=================================================================================================
@@ -1673,6 +1683,7 @@ void Geom_BSplineSurface::SetPoleRow(const Standard_Integer    UIndex,
   {
     Poles(UIndex + Poles.LowerRow() - 1, I + Poles.LowerCol() - 1) = CPoles(I);
   }
+  ResetCacheTable();
 }
 
 //=================================================================================================
@@ -1692,6 +1703,7 @@ void Geom_BSplineSurface::SetPole(const Standard_Integer UIndex,
                                   const Point3d&          P)
 {
   poles->SetValue(UIndex + poles->LowerRow() - 1, VIndex + poles->LowerCol() - 1, P);
+  ResetCacheTable();
 }
 
 //=================================================================================================
@@ -1753,6 +1765,7 @@ void Geom_BSplineSurface::MovePoint(const Standard_Real    U,
   if (UFirstModifiedPole)
   {
     poles->ChangeArray2() = npoles;
+    ResetCacheTable();
   }
   maxderivinvok = 0;
 }
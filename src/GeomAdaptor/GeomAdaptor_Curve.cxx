@@ -46,6 +46,7 @@
 #include <gp_Pnt.hxx>
 #include <gp_Vec.hxx>
 #include <Precision.hxx>
+#include <Standard_DimensionError.hxx>
 #include <Standard_DomainError.hxx>
 #include <Standard_NoSuchObject.hxx>
 #include <Standard_NotImplemented.hxx>
@@ -610,6 +611,54 @@ void GeomAdaptor_Curve::D0(const Standard_Real U, Point3d& P) const
 
 //=================================================================================================
 
+void GeomAdaptor_Curve::D0(const TColStd_Array1OfReal& theParameters,
+                           TColgp_Array1OfPnt&         thePoints) const
+{
+  Standard_DimensionError_Raise_if(theParameters.Lower() != thePoints.Lower()
+                                     || theParameters.Upper() != thePoints.Upper(),
+                                   "GeomAdaptor_Curve::D0: arrays bounds mismatch");
+  if (myTypeCurve != GeomAbs_BezierCurve && myTypeCurve != GeomAbs_BSplineCurve)
+  {
+    for (Standard_Integer anIndex = theParameters.Lower(); anIndex <= theParameters.Upper();
+         ++anIndex)
+    {
+      D0(theParameters(anIndex), thePoints.ChangeValue(anIndex));
+    }
+    return;
+  }
+
+  Standard_Integer anIndex = theParameters.Lower();
+  while (anIndex <= theParameters.Upper())
+  {
+    const Standard_Real aU = theParameters(anIndex);
+    if (myCurveCache.IsNull() || !myCurveCache->IsCacheValid(aU))
+      RebuildCache(aU);
+    // compute all the next points of the span by cached data
+    const Standard_Integer aNext = myCurveCache->D0(theParameters, anIndex, thePoints);
+    if (aNext == anIndex)
+    {
+      // the parameter is not in the rebuilt span (e.g. NaN), it is computed alone
+      D0(aU, thePoints.ChangeValue(anIndex++));
+      continue;
+    }
+
+    // the ends of the curve are computed as in D0() for single parameter
+    for (; anIndex < aNext; ++anIndex)
+    {
+      Standard_Integer aStart = 0, aFinish = 0;
+      if (IsBoundary(theParameters(anIndex), aStart, aFinish))
+      {
+        myBSplineCurve->LocalD0(theParameters(anIndex),
+                                aStart,
+                                aFinish,
+                                thePoints.ChangeValue(anIndex));
+      }
+    }
+  }
+}
+
+//=================================================================================================
+
 void GeomAdaptor_Curve::D1(const Standard_Real U, Point3d& P, Vector3d& V) const
 {
   switch (myTypeCurve)
@@ -128,6 +128,15 @@ public:
   //! Computes the point of parameter U.
   Standard_EXPORT void D0(const Standard_Real U, Point3d& P) const Standard_OVERRIDE;
 
+  //! Computes the points of parameters theParameters.
+  //! On Bezier and B-spline curves the cached polynomial of the span is reused
+  //! for the consecutive parameters lying in the same span and evaluated on
+  //! several points at once, thus sorted parameters (sampling, tessellation)
+  //! are computed faster than by successive calls of D0().
+  //! thePoints should have the same bounds as theParameters.
+  Standard_EXPORT void D0(const TColStd_Array1OfReal& theParameters,
+                          TColgp_Array1OfPnt&         thePoints) const;
+
   //! Computes the point of parameter U on the curve
   //! with its first derivative.
   //!
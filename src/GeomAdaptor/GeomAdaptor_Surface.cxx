@@ -54,6 +54,7 @@
 #include <gp_Torus.hxx>
 #include <gp_Vec.hxx>
 #include <Precision.hxx>
+#include <Standard_DimensionError.hxx>
 #include <Standard_DomainError.hxx>
 #include <Standard_NoSuchObject.hxx>
 #include <Standard_NullObject.hxx>
@@ -703,21 +704,8 @@ void GeomAdaptor_Surface::RebuildCache(const Standard_Real theU, const Standard_
   }
   else if (mySurfaceType == GeomAbs_BSplineSurface)
   {
-    // Create cache for B-spline
-    if (mySurfaceCache.IsNull())
-      mySurfaceCache = new BSplSLib_Cache(myBSplineSurface->UDegree(),
-                                          myBSplineSurface->IsUPeriodic(),
-                                          myBSplineSurface->UKnotSequence(),
-                                          myBSplineSurface->VDegree(),
-                                          myBSplineSurface->IsVPeriodic(),
-                                          myBSplineSurface->VKnotSequence(),
-                                          myBSplineSurface->Weights());
-    mySurfaceCache->BuildCache(theU,
-                               theV,
-                               myBSplineSurface->UKnotSequence(),
-                               myBSplineSurface->VKnotSequence(),
-                               myBSplineSurface->Poles(),
-                               myBSplineSurface->Weights());
+    // Take cache of B-spline span shared by all adaptors of the surface
+    mySurfaceCache = myBSplineSurface->SpanCache(theU, theV);
   }
 }
 
@@ -818,6 +806,109 @@ void GeomAdaptor_Surface::D1(const Standard_Real U,
 
 //=================================================================================================
 
+void GeomAdaptor_Surface::D0(const TColStd_Array1OfReal& theU,
+                             const TColStd_Array1OfReal& theV,
+                             TColgp_Array1OfPnt&         thePoints) const
+{
+  Standard_DimensionError_Raise_if(theU.Lower() != theV.Lower() || theU.Upper() != theV.Upper()
+                                     || theU.Lower() != thePoints.Lower()
+                                     || theU.Upper() != thePoints.Upper(),
+                                   "GeomAdaptor_Surface::D0: arrays bounds mismatch");
+  if (mySurfaceType != GeomAbs_BezierSurface && mySurfaceType != GeomAbs_BSplineSurface)
+  {
+    for (Standard_Integer anIndex = theU.Lower(); anIndex <= theU.Upper(); ++anIndex)
+    {
+      D0(theU(anIndex), theV(anIndex), thePoints.ChangeValue(anIndex));
+    }
+    return;
+  }
+
+  Standard_Integer anIndex = theU.Lower();
+  while (anIndex <= theU.Upper())
+  {
+    if (mySurfaceCache.IsNull() || !mySurfaceCache->IsCacheValid(theU(anIndex), theV(anIndex)))
+      RebuildCache(theU(anIndex), theV(anIndex));
+    const Standard_Integer aNext = mySurfaceCache->D0(theU, theV, anIndex, thePoints);
+    if (aNext == anIndex)
+    {
+      // the parameters are not in the rebuilt span (e.g. NaN), they are computed alone
+      D0(theU(anIndex), theV(anIndex), thePoints.ChangeValue(anIndex));
+      ++anIndex;
+      continue;
+    }
+    anIndex = aNext;
+  }
+}
+
+//=================================================================================================
+
+void GeomAdaptor_Surface::D1(const TColStd_Array1OfReal& theU,
+                             const TColStd_Array1OfReal& theV,
+                             TColgp_Array1OfPnt&         thePoints,
+                             TColgp_Array1OfVec&         theD1U,
+                             TColgp_Array1OfVec&         theD1V) const
+{
+  Standard_DimensionError_Raise_if(theU.Lower() != theV.Lower() || theU.Upper() != theV.Upper()
+                                     || theU.Lower() != thePoints.Lower()
+                                     || theU.Upper() != thePoints.Upper()
+                                     || theU.Lower() != theD1U.Lower()
+                                     || theU.Upper() != theD1U.Upper()
+                                     || theU.Lower() != theD1V.Lower()
+                                     || theU.Upper() != theD1V.Upper(),
+                                   "GeomAdaptor_Surface::D1: arrays bounds mismatch");
+  if (mySurfaceType != GeomAbs_BezierSurface && mySurfaceType != GeomAbs_BSplineSurface)
+  {
+    for (Standard_Integer anIndex = theU.Lower(); anIndex <= theU.Upper(); ++anIndex)
+    {
+      D1(theU(anIndex),
+         theV(anIndex),
+         thePoints.ChangeValue(anIndex),
+         theD1U.ChangeValue(anIndex),
+         theD1V.ChangeValue(anIndex));
+    }
+    return;
+  }
+
+  Standard_Integer anIndex = theU.Lower();
+  while (anIndex <= theU.Upper())
+  {
+    if (mySurfaceCache.IsNull() || !mySurfaceCache->IsCacheValid(theU(anIndex), theV(anIndex)))
+      RebuildCache(theU(anIndex), theV(anIndex));
+    const Standard_Integer aNext =
+      mySurfaceCache->D1(theU, theV, anIndex, thePoints, theD1U, theD1V);
+    if (aNext == anIndex)
+    {
+      // the parameters are not in the rebuilt span (e.g. NaN), they are computed alone
+      D1(theU(anIndex),
+         theV(anIndex),
+         thePoints.ChangeValue(anIndex),
+         theD1U.ChangeValue(anIndex),
+         theD1V.ChangeValue(anIndex));
+      ++anIndex;
+      continue;
+    }
+
+    // the points close to the bounds of the surface are computed as in D1()
+    // for single parameters, i.e. on the local span of the B-spline
+    for (; anIndex < aNext; ++anIndex)
+    {
+      const Standard_Real aU = theU(anIndex);
+      const Standard_Real aV = theV(anIndex);
+      if (Abs(aU - myUFirst) <= myTolU || Abs(aU - myULast) <= myTolU
+          || Abs(aV - myVFirst) <= myTolV || Abs(aV - myVLast) <= myTolV)
+      {
+        D1(aU,
+           aV,
+           thePoints.ChangeValue(anIndex),
+           theD1U.ChangeValue(anIndex),
+           theD1V.ChangeValue(anIndex));
+      }
+    }
+  }
+}
+
+//=================================================================================================
+
 void GeomAdaptor_Surface::D2(const Standard_Real U,
                              const Standard_Real V,
                              Point3d&             P,
@@ -188,6 +188,24 @@ public:
                           Vector3d&             D1U,
                           Vector3d&             D1V) const Standard_OVERRIDE;
 
+  //! Computes the points of parameters (theU(i), theV(i)) on the surface.
+  //! On Bezier and B-spline surfaces the cached polynomial of the span is reused
+  //! for the consecutive parameters lying in the same span, thus sorted parameters
+  //! (sampling, tessellation) are computed faster than by successive calls of D0().
+  //! theV and thePoints should have the same bounds as theU.
+  Standard_EXPORT void D0(const TColStd_Array1OfReal& theU,
+                          const TColStd_Array1OfReal& theV,
+                          TColgp_Array1OfPnt&         thePoints) const;
+
+  //! Computes the points and the first derivatives for parameters (theU(i), theV(i))
+  //! on the surface, with the same results as successive calls of D1().
+  //! theV and the output arrays should have the same bounds as theU.
+  Standard_EXPORT void D1(const TColStd_Array1OfReal& theU,
+                          const TColStd_Array1OfReal& theV,
+                          TColgp_Array1OfPnt&         thePoints,
+                          TColgp_Array1OfVec&         theD1U,
+                          TColgp_Array1OfVec&         theD1V) const;
+
   //! Computes   the point,  the  first  and  second
   //! derivatives on the surface.
   //!
@@ -43,6 +43,7 @@
 #include <TColStd_ListIteratorOfListOfInteger.hxx>
 #include <algorithm>
 #include <NCollection_IndexedDataMap.hxx>
+#include <OSD_Parallel.hxx>
 
 typedef NCollection_Array1<Standard_Integer> IntPolyh_ArrayOfInteger;
 typedef NCollection_IndexedDataMap<Standard_Integer, TColStd_ListOfInteger>
@@ -51,6 +52,13 @@ typedef NCollection_IndexedDataMap<Standard_Integer, TColStd_ListOfInteger>
 static Standard_Real MyTolerance                = 10.0e-7;
 static Standard_Real MyConfusionPrecision       = 10.0e-12;
 static Standard_Real SquareMyConfusionPrecision = 10.0e-24;
+
+//! Minimal number of couples of triangles to check their contact in parallel
+static const Standard_Integer THE_PARALLEL_MIN_NB_COUPLES = 2000;
+//! Value marking the couple of triangles without contact
+static const Standard_Real THE_NO_CONTACT = -3.0;
+//! Value marking the couple of triangles in contact with degenerated normal (angle is not computed)
+static const Standard_Real THE_UNDEFINED_ANGLE = -4.0;
 //
 static inline Standard_Real maxSR(const Standard_Real a,
                                   const Standard_Real b,
@@ -188,12 +196,14 @@ private:
 //=======================================================================
 // function : GetInterferingTriangles
 // purpose  : Returns indices of the triangles with interfering bounding boxes
+//            sorted by the index of the triangle of the first surface
 //=======================================================================
-static void GetInterferingTriangles(IntPolyh_ArrayOfTriangles&                     theTriangles1,
-                                    const IntPolyh_ArrayOfPoints&                  thePoints1,
-                                    IntPolyh_ArrayOfTriangles&                     theTriangles2,
-                                    const IntPolyh_ArrayOfPoints&                  thePoints2,
-                                    IntPolyh_IndexedDataMapOfIntegerListOfInteger& theCouples)
+static void GetInterferingTriangles(
+  IntPolyh_ArrayOfTriangles&                         theTriangles1,
+  const IntPolyh_ArrayOfPoints&                      thePoints1,
+  IntPolyh_ArrayOfTriangles&                         theTriangles2,
+  const IntPolyh_ArrayOfPoints&                      thePoints2,
+  std::vector<IntPolyh_BoxBndTreeSelector::PairIDs>& thePairs)
 {
   // Use linear builder for BVH construction
   opencascade::handle<BVH_LinearBuilder<Standard_Real, 3>> aLBuilder =
@@ -234,18 +244,74 @@ static void GetInterferingTriangles(IntPolyh_ArrayOfTriangles&
   aSelector.Select();
   aSelector.Sort();
 
-  const std::vector<IntPolyh_BoxBndTreeSelector::PairIDs>& aPairs = aSelector.Pairs();
-  const Standard_Integer aNbPairs = static_cast<Standard_Integer>(aPairs.size());
+  thePairs = aSelector.Pairs();
+}
 
-  for (Standard_Integer i = 0; i < aNbPairs; ++i)
-  {
-    const IntPolyh_BoxBndTreeSelector::PairIDs& aPair       = aPairs[i];
-    TColStd_ListOfInteger*                      pTriangles2 = theCouples.ChangeSeek(aPair.ID1);
-    if (!pTriangles2)
-      pTriangles2 = &theCouples(theCouples.Add(aPair.ID1, TColStd_ListOfInteger()));
-    pTriangles2->Append(aPair.ID2);
+//=======================================================================
+// class    : IntPolyh_TriContactFunctor
+// purpose  : Checks the contact of the couples of triangles with
+//            interfering boxes. The couples are independent, thus
+//            the checks are performed in parallel; the results are
+//            stored by index of the couple to keep the order of
+//            the couples independent on the threads scheduling.
+//=======================================================================
+class IntPolyh_TriContactFunctor
+{
+public:
+  IntPolyh_TriContactFunctor(const IntPolyh_MaillageAffinage&                         theMaillage,
+                             const std::vector<IntPolyh_BoxBndTreeSelector::PairIDs>& thePairs,
+                             const IntPolyh_ArrayOfTriangles&                         theTriangles1,
+                             const IntPolyh_ArrayOfPoints&                            thePoints1,
+                             const IntPolyh_ArrayOfTriangles&                         theTriangles2,
+                             const IntPolyh_ArrayOfPoints&                            thePoints2,
+                             std::vector<Standard_Real>&                              theAngles)
+      : myMaillage(theMaillage),
+        myPairs(thePairs),
+        myTriangles1(theTriangles1),
+        myPoints1(thePoints1),
+        myTriangles2(theTriangles2),
+        myPoints2(thePoints2),
+        myAngles(theAngles)
+  {
+  }
+
+  //! Checks the contact of the couple theIndex; the angle of the couple is stored
+  //! in the output array, or THE_NO_CONTACT if the triangles are not in contact.
+  void operator()(const Standard_Integer theIndex) const
+  {
+    const IntPolyh_BoxBndTreeSelector::PairIDs& aPair      = myPairs[theIndex];
+    const Triangle4&                            aTriangle1 = myTriangles1[aPair.ID1];
+    const Triangle4&                            aTriangle2 = myTriangles2[aPair.ID2];
+
+    Standard_Real anAngle = THE_UNDEFINED_ANGLE;
+    if (myMaillage.TriContact(myPoints1[aTriangle1.FirstPoint()],
+                              myPoints1[aTriangle1.SecondPoint()],
+                              myPoints1[aTriangle1.ThirdPoint()],
+                              myPoints2[aTriangle2.FirstPoint()],
+                              myPoints2[aTriangle2.SecondPoint()],
+                              myPoints2[aTriangle2.ThirdPoint()],
+                              anAngle))
+    {
+      myAngles[theIndex] = anAngle;
+    }
+    else
+    {
+      myAngles[theIndex] = THE_NO_CONTACT;
+    }
   }
-}
+
+private:
+  IntPolyh_TriContactFunctor& operator=(const IntPolyh_TriContactFunctor&);
+
+private:
+  const IntPolyh_MaillageAffinage&                         myMaillage;
+  const std::vector<IntPolyh_BoxBndTreeSelector::PairIDs>& myPairs;
+  const IntPolyh_ArrayOfTriangles&                         myTriangles1;
+  const IntPolyh_ArrayOfPoints&                            myPoints1;
+  const IntPolyh_ArrayOfTriangles&                         myTriangles2;
+  const IntPolyh_ArrayOfPoints&                            myPoints2;
+  std::vector<Standard_Real>&                              myAngles;
+};
 
 //=================================================================================================
 
@@ -1062,8 +1128,18 @@ static void TrianglesDeflectionsRefinement(const Handle(SurfaceAdaptor)& theS1,
                                            const Standard_Real              theFlecheCritique2)
 {
   // Find the intersecting triangles
+  std::vector<IntPolyh_BoxBndTreeSelector::PairIDs> aPairs;
+  GetInterferingTriangles(theTriangles1, thePoints1, theTriangles2, thePoints2, aPairs);
   IntPolyh_IndexedDataMapOfIntegerListOfInteger aDMILI;
-  GetInterferingTriangles(theTriangles1, thePoints1, theTriangles2, thePoints2, aDMILI);
+  for (std::vector<IntPolyh_BoxBndTreeSelector::PairIDs>::const_iterator aPairIt = aPairs.begin();
+       aPairIt != aPairs.end();
+       ++aPairIt)
+  {
+    TColStd_ListOfInteger* pTriangles2 = aDMILI.ChangeSeek(aPairIt->ID1);
+    if (!pTriangles2)
+      pTriangles2 = &aDMILI(aDMILI.Add(aPairIt->ID1, TColStd_ListOfInteger()));
+    pTriangles2->Append(aPairIt->ID2);
+  }
   //
   // Interfering triangles of second surface
   TColStd_MapOfInteger aMIntS2;
@@ -2826,44 +2902,40 @@ Standard_Integer IntPolyh_MaillageAffinage::TriangleEdgeContact(const Standard_I
 Standard_Integer IntPolyh_MaillageAffinage::TriangleCompare()
 {
   // Find couples with interfering bounding boxes
-  IntPolyh_IndexedDataMapOfIntegerListOfInteger aDMILI;
-  GetInterferingTriangles(TTriangles1, TPoints1, TTriangles2, TPoints2, aDMILI);
-  if (aDMILI.IsEmpty())
+  std::vector<IntPolyh_BoxBndTreeSelector::PairIDs> aPairs;
+  GetInterferingTriangles(TTriangles1, TPoints1, TTriangles2, TPoints2, aPairs);
+  if (aPairs.empty())
   {
     return 0;
   }
   //
-  Standard_Real CoupleAngle = -2.0;
-  //
   // Intersection of the triangles
-  Standard_Integer i, aNb = aDMILI.Extent();
-  for (i = 1; i <= aNb; ++i)
-  {
-    const Standard_Integer i_S1      = aDMILI.FindKey(i);
-    Triangle4&     Triangle1 = TTriangles1[i_S1];
-    const Point3&  P1        = TPoints1[Triangle1.FirstPoint()];
-    const Point3&  P2        = TPoints1[Triangle1.SecondPoint()];
-    const Point3&  P3        = TPoints1[Triangle1.ThirdPoint()];
-    //
-    const TColStd_ListOfInteger&    aLI2 = aDMILI(i);
-    TColStd_ListOfInteger::Iterator aItLI(aLI2);
-    for (; aItLI.More(); aItLI.Next())
-    {
-      const Standard_Integer i_S2      = aItLI.Value();
-      Triangle4&     Triangle2 = TTriangles2[i_S2];
-      const Point3&  Q1        = TPoints2[Triangle2.FirstPoint()];
-      const Point3&  Q2        = TPoints2[Triangle2.SecondPoint()];
-      const Point3&  Q3        = TPoints2[Triangle2.ThirdPoint()];
-      //
-      if (TriContact(P1, P2, P3, Q1, Q2, Q3, CoupleAngle))
-      {
-        Couple aCouple(i_S1, i_S2, CoupleAngle);
-        TTrianglesContacts.Append(aCouple);
-        //
-        Triangle1.SetIntersection(Standard_True);
-        Triangle2.SetIntersection(Standard_True);
-      }
+  const Standard_Integer     aNbPairs = static_cast<Standard_Integer>(aPairs.size());
+  std::vector<Standard_Real> anAngles(aPairs.size());
+  IntPolyh_TriContactFunctor
+    aFunctor(*this, aPairs, TTriangles1, TPoints1, TTriangles2, TPoints2, anAngles);
+  // the check of one couple is cheap, do not bother the threads for small meshes
+  Parallel1::For(0, aNbPairs, aFunctor, aNbPairs < THE_PARALLEL_MIN_NB_COUPLES);
+  //
+  // the couple with undefined angle takes the angle of the previous couple in contact
+  Standard_Real CoupleAngle = -2.0;
+  for (Standard_Integer i = 0; i < aNbPairs; ++i)
+  {
+    if (anAngles[i] == THE_NO_CONTACT)
+    {
+      continue;
     }
+    if (anAngles[i] != THE_UNDEFINED_ANGLE)
+    {
+      CoupleAngle = anAngles[i];
+    }
+    //
+    const IntPolyh_BoxBndTreeSelector::PairIDs& aPair = aPairs[i];
+    Couple                                      aCouple(aPair.ID1, aPair.ID2, CoupleAngle);
+    TTrianglesContacts.Append(aCouple);
+    //
+    TTriangles1[aPair.ID1].SetIntersection(Standard_True);
+    TTriangles2[aPair.ID2].SetIntersection(Standard_True);
   }
   return TTrianglesContacts.Extent();
 }
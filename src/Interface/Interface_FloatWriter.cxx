@@ -15,6 +15,189 @@
 
 #include <Interface_FloatWriter.hxx>
 
+#include <cmath>
+#include <cstring>
+#include <stdint.h>
+
+namespace
+{
+//! Parses the format "%<width>.<precision><type>", the only one converted without sprintf.
+static bool parseFloatFormat(const char* theFormat, int& theWidth, int& thePrecision, char& theType)
+{
+  if (*theFormat++ != '%')
+  {
+    return false;
+  }
+  theWidth = 0;
+  for (; *theFormat >= '0' && *theFormat <= '9'; ++theFormat)
+  {
+    theWidth = theWidth * 10 + (*theFormat - '0');
+  }
+  if (*theFormat++ != '.' || *theFormat < '0' || *theFormat > '9')
+  {
+    return false;
+  }
+  thePrecision = 0;
+  for (; *theFormat >= '0' && *theFormat <= '9'; ++theFormat)
+  {
+    thePrecision = thePrecision * 10 + (*theFormat - '0');
+  }
+  theType = *theFormat++;
+  return *theFormat == '\0' && theWidth <= 24 && thePrecision >= 1 && thePrecision <= 17;
+}
+
+//! Computes the 128-bit product theHigh:theLow of two 64-bit integers.
+static void multiply64(const uint64_t theA,
+                       const uint64_t theB,
+                       uint64_t&      theHigh,
+                       uint64_t&      theLow)
+{
+  const uint64_t aALow = theA & 0xFFFFFFFFu, aAHigh = theA >> 32;
+  const uint64_t aBLow = theB & 0xFFFFFFFFu, aBHigh = theB >> 32;
+  const uint64_t aLL = aALow * aBLow, aLH = aALow * aBHigh, aHL = aAHigh * aBLow;
+  const uint64_t aMid = (aLL >> 32) + (aLH & 0xFFFFFFFFu) + (aHL & 0xFFFFFFFFu);
+  theLow              = (aLL & 0xFFFFFFFFu) | (aMid << 32);
+  theHigh             = aAHigh * aBHigh + (aLH >> 32) + (aHL >> 32) + (aMid >> 32);
+}
+
+//! Puts the text to the end of the buffer of the given width, padded by blanks.
+static void alignRight(const char* theText, const int theLength, const int theWidth, char* theBuffer)
+{
+  int aPos = 0;
+  for (; aPos < theWidth - theLength; ++aPos)
+  {
+    theBuffer[aPos] = ' ';
+  }
+  memcpy(theBuffer + aPos, theText, theLength);
+  theBuffer[aPos + theLength] = '\0';
+}
+
+//! Writes the value as sprintf does with the format "%<width>.<precision>f",
+//! using exact integer arithmetic (the decimal value is rounded half to even).
+//! Returns false if the value is too large or too small for this conversion.
+static bool writeFixed(const double theValue,
+                       const int    theWidth,
+                       const int    thePrecision,
+                       char*        theText)
+{
+  if (!std::isfinite(theValue))
+  {
+    return false;
+  }
+  // |theValue| = aMantissa / 2^aShift, with the integer mantissa of 53 bits
+  int            anExp     = 0;
+  const uint64_t aMantissa = (uint64_t)std::ldexp(std::frexp(std::fabs(theValue), &anExp), 53);
+  const int      aShift    = 53 - anExp;
+  if (aShift <= 0 || aShift >= 128)
+  {
+    return false;
+  }
+
+  // aHigh:aLow = |theValue| * 10^precision * 2^aShift
+  uint64_t aScale = 1;
+  for (int aDigit = 0; aDigit < thePrecision; ++aDigit)
+  {
+    aScale *= 10;
+  }
+  uint64_t aHigh = 0, aLow = 0;
+  multiply64(aMantissa, aScale, aHigh, aLow);
+
+  // integer part of the product divided by 2^aShift, the remainder is compared with the half
+  uint64_t aResult = 0, aRemHigh = 0, aRemLow = 0, aHalfHigh = 0, aHalfLow = 0;
+  if (aShift < 64)
+  {
+    if ((aHigh >> aShift) != 0)
+    {
+      return false;
+    }
+    aResult  = (aHigh << (64 - aShift)) | (aLow >> aShift);
+    aRemLow  = aLow & ((uint64_t(1) << aShift) - 1);
+    aHalfLow = uint64_t(1) << (aShift - 1);
+  }
+  else if (aShift == 64)
+  {
+    aResult  = aHigh;
+    aRemLow  = aLow;
+    aHalfLow = uint64_t(1) << 63;
+  }
+  else
+  {
+    aResult   = aHigh >> (aShift - 64);
+    aRemHigh  = aHigh & ((uint64_t(1) << (aShift - 64)) - 1);
+    aRemLow   = aLow;
+    aHalfHigh = uint64_t(1) << (aShift - 65);
+  }
+  if (aRemHigh > aHalfHigh || (aRemHigh == aHalfHigh && aRemLow > aHalfLow)
+      || (aRemHigh == aHalfHigh && aRemLow == aHalfLow && (aResult & 1) != 0))
+  {
+    ++aResult;
+  }
+  if (aResult >= uint64_t(1000000000000000000u))
+  {
+    return false;
+  }
+
+  // digits are written from the end
+  char  aBuffer[32];
+  char* aPos = aBuffer + sizeof(aBuffer);
+  for (int aDigit = 0; aDigit < thePrecision; ++aDigit)
+  {
+    *--aPos = char('0' + aResult % 10);
+    aResult /= 10;
+  }
+  *--aPos = '.';
+  do
+  {
+    *--aPos = char('0' + aResult % 10);
+    aResult /= 10;
+  } while (aResult != 0);
+  if (std::signbit(theValue))
+  {
+    *--aPos = '-';
+  }
+  alignRight(aPos, int(aBuffer + sizeof(aBuffer) - aPos), theWidth, theText);
+  return true;
+}
+
+//! Writes the value without sprintf if the format and the value allow it:
+//! any value with the format "%<width>.<precision>f", zero with "%<width>.<precision>E".
+static bool writeFast(const double theValue, const char* theFormat, char* theText)
+{
+  int  aWidth = 0, aPrecision = 0;
+  char aType = '\0';
+  if (!parseFloatFormat(theFormat, aWidth, aPrecision, aType))
+  {
+    return false;
+  }
+  if (aType == 'f')
+  {
+    return writeFixed(theValue, aWidth, aPrecision, theText);
+  }
+  if ((aType == 'E' || aType == 'e') && theValue == 0.0)
+  {
+    char aBuffer[32];
+    int  aLength = 0;
+    if (std::signbit(theValue))
+    {
+      aBuffer[aLength++] = '-';
+    }
+    aBuffer[aLength++] = '0';
+    aBuffer[aLength++] = '.';
+    for (int aDigit = 0; aDigit < aPrecision; ++aDigit)
+    {
+      aBuffer[aLength++] = '0';
+    }
+    aBuffer[aLength++] = aType;
+    aBuffer[aLength++] = '+';
+    aBuffer[aLength++] = '0';
+    aBuffer[aLength++] = '0';
+    alignRight(aBuffer, aLength, aWidth, theText);
+    return true;
+  }
+  return false;
+}
+} // namespace
+
 InterfaceFloatWriter::InterfaceFloatWriter(const Standard_Integer chars)
 {
   SetDefaults(chars);
@@ -117,9 +300,13 @@ Standard_Integer InterfaceFloatWriter::Convert(const Standard_Real    val,
 
   pText = (char*)text;
   //
+  //  the usual formats are written without sprintf, with the same result
   if ((val >= R1 && val < R2) || (val <= -R1 && val > -R2))
-    Sprintf(pText, rangeform, val);
-  else
+  {
+    if (!writeFast(val, rangeform, pText))
+      Sprintf(pText, rangeform, val);
+  }
+  else if (!writeFast(val, mainform, pText))
     Sprintf(pText, mainform, val);
 
   if (zsup)
@@ -177,6 +177,17 @@ Handle(TCollection_HAsciiString) LineBuffer::Moved()
   return R;
 }
 
+Standard_CString LineBuffer::Moved(const Handle(NCollection_BaseAllocator)& theAllocator,
+                                   Standard_Integer&                        theLength)
+{
+  Prepare();
+  theLength   = (Standard_Integer)strlen(&myLine.First());
+  char* aText = (char*)theAllocator->Allocate(theLength + 1);
+  memcpy(aText, &myLine.First(), theLength + 1);
+  Keep();
+  return aText;
+}
+
 // ....                        AJOUTS                        ....
 
 void LineBuffer::Add(const Standard_CString theText)
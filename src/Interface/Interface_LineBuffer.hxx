@@ -77,6 +77,11 @@ public:
   //! Same as above, but generates the HAsciiString
   Standard_EXPORT Handle(TCollection_HAsciiString) Moved();
 
+  //! Same as above, but copies the Content (with the final null character)
+  //! to the memory taken from <theAllocator>, and returns its length in <theLength>
+  Standard_EXPORT Standard_CString Moved(const Handle(NCollection_BaseAllocator)& theAllocator,
+                                         Standard_Integer&                        theLength);
+
   //! Adds a text as a CString. Its Length is evaluated from the
   //! text (by C function strlen)
   Standard_EXPORT void Add(const Standard_CString text);
@@ -32,6 +32,7 @@ class LDOMBasicString1
 {
   friend class MemoryManager;
   friend class LDOM_Node;
+  friend class LDOMParser;
 
 public:
   enum StringType
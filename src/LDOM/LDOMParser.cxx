@@ -358,30 +358,49 @@ Standard_Boolean LDOMParser::ParseElement(Standard_IStream& theIStream,
       case LDOM_XmlReader::XML_TEXT:
         aLocType = LDOM_Node::TEXT_NODE;
         {
-          Standard_Integer aTextLen;
-          aTextStr = CharReference::Decode((char*)myCurrentData.str(), aTextLen);
-          // try to convert to integer
-          if (IsDigit(aTextStr[0]))
+          // The text (e.g. the shapes section) may be very large: it is collected
+          // and decoded directly in the document memory, without a temporary copy
+          Standard_Integer aTextLen = myCurrentData.Length();
+          aTextStr                  = (char*)myDocument->Allocate(aTextLen + 1);
+          myCurrentData.Copy(aTextStr);
+          if (CharReference::Decode(aTextStr, aTextLen) == NULL)
           {
-            if (LDOM_XmlReader::getInteger(aTextValue, aTextStr, aTextStr + aTextLen))
-              aTextValue = LDOMBasicString1(aTextStr, aTextLen, myDocument);
+            myError  = "Invalid character reference in text";
+            isError  = Standard_True;
+            aTextStr = NULL;
+            break;
           }
-          else
-            aTextValue = LDOMBasicString1(aTextStr, aTextLen, myDocument);
+          // try to convert to integer, an empty text is kept as an empty string
+          if (!IsDigit(aTextStr[0])
+              || LDOM_XmlReader::getInteger(aTextValue, aTextStr, aTextStr + aTextLen))
+            aTextValue.SetDirect(LDOMBasicString1::LDOM_AsciiDoc, aTextStr);
+          aTextStr = NULL;
         }
         goto create_text_node;
       case LDOM_XmlReader::XML_COMMENT:
         aLocType = LDOM_Node::COMMENT_NODE;
         {
           Standard_Integer aTextLen;
-          aTextStr   = CharReference::Decode((char*)myCurrentData.str(), aTextLen);
+          char*            aComment = (char*)myCurrentData.str();
+          aTextStr                  = CharReference::Decode(aComment, aTextLen);
+          if (aTextStr == NULL)
+          {
+            delete[] aComment;
+            myError = "Invalid character reference in comment";
+            isError = Standard_True;
+            break;
+          }
           aTextValue = LDOMBasicString1(aTextStr, aTextLen, myDocument);
         }
         goto create_text_node;
       case LDOM_XmlReader::XML_CDATA:
-        aLocType   = LDOM_Node::CDATA_SECTION_NODE;
-        aTextStr   = (char*)myCurrentData.str();
-        aTextValue = LDOMBasicString1(aTextStr, myCurrentData.Length(), myDocument);
+        aLocType = LDOM_Node::CDATA_SECTION_NODE;
+        {
+          char* aDocStr = (char*)myDocument->Allocate(myCurrentData.Length() + 1);
+          myCurrentData.Copy(aDocStr);
+          aTextValue.SetDirect(LDOMBasicString1::LDOM_AsciiDoc, aDocStr);
+        }
+        aTextStr = NULL;
       create_text_node: {
         BasicNode& aTextNode = BasicText::Create(aLocType, aTextValue, myDocument);
         aParent->AppendChild(&aTextNode, aLastChild);
@@ -62,18 +62,23 @@ void StringBuffer::Clear()
 Standard_CString StringBuffer::str() const
 {
   char* aRetStr = new char[myLength + 1];
+  Copy(aRetStr);
+  return aRetStr;
+}
+
+//=================================================================================================
 
+void StringBuffer::Copy(char* theBuffer) const
+{
   StringElement* aCurElem = myFirstString;
   int              aCurLen  = 0;
   while (aCurElem)
   {
-    strncpy(aRetStr + aCurLen, aCurElem->buf, aCurElem->len);
+    memcpy(theBuffer + aCurLen, aCurElem->buf, aCurElem->len);
     aCurLen += aCurElem->len;
     aCurElem = aCurElem->next;
   }
-  *(aRetStr + myLength) = '\0';
-
-  return aRetStr;
+  theBuffer[myLength] = '\0';
 }
 
 //=======================================================================
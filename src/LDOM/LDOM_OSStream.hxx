@@ -59,6 +59,11 @@ public:
   //! for memory release after the string usage.
   Standard_EXPORT Standard_CString str() const;
 
+  //! Concatenates strings of all sequence elements into the
+  //! given buffer, which should hold at least Length() + 1 chars.
+  //! Allows placing the string into memory owned by the caller.
+  Standard_EXPORT void Copy(char* theBuffer) const;
+
   //! Returns full length of data contained
   Standard_Integer Length() const { return myLength; }
 
@@ -104,6 +109,8 @@ public:
 
   Standard_CString str() const { return myBuffer.str(); }
 
+  void Copy(char* theBuffer) const { myBuffer.Copy(theBuffer); }
+
   Standard_Integer Length() const { return myBuffer.Length(); }
 
   void Clear() { myBuffer.Clear(); }
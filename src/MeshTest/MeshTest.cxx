@@ -40,6 +40,7 @@
 #include <Message_ProgressRange.hxx>
 #include <OSD_OpenFile.hxx>
 #include <Poly_MergeNodesTool.hxx>
+#include <Poly_TriangulationCache.hxx>
 #include <Poly_TriangulationParameters.hxx>
 #include <Prs3d_Drawer.hxx>
 #include <StdPrs_ToolTriangulatedShape.hxx>
@@ -664,6 +665,36 @@ static Standard_Integer TrLateLoad(DrawInterpreter& theDI,
 
       continue;
     }
+    else if (anArgIter + 1 < theNbArgs && anArgCase == "-loadbudget"
+             && AsciiString1(theArgVec[anArgIter + 1]).IsRealValue(Standard_True))
+    {
+      // the budget may exceed the range of Standard_Integer
+      const Standard_Real aBudget = AsciiString1(theArgVec[++anArgIter]).RealValue();
+      if (aBudget < 0.0)
+      {
+        Message1::SendWarning("Invalid negative memory budget");
+        continue;
+      }
+      // Load active triangulations of the faces one by one keeping the memory budget
+      Handle(Poly_TriangulationCache) aCache =
+        new Poly_TriangulationCache((Standard_Size)aBudget);
+      for (ShapeExplorer aFaceIter(aShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+      {
+        TopLoc_Location                  aLoc;
+        const Handle(MeshTriangulation)& aTriangulation =
+          BRepInspector::Triangulation(TopoDS::Face(aFaceIter.Current()), aLoc);
+        if (!aTriangulation.IsNull() && aTriangulation->HasDeferredData())
+        {
+          aCache->Load(aTriangulation);
+        }
+      }
+      Standard_SStream aStat;
+      aStat << "Loaded: " << aCache->NbLoads() << " Hits: " << aCache->NbHits()
+            << " Evicted: " << aCache->NbEvictions() << "\n"
+            << "In memory: " << aCache->NbLoaded() << " (" << aCache->LoadedSize() << " bytes)\n";
+      theDI << aStat;
+      continue;
+    }
     else if (anArgCase == "-loadsingleexact" || anArgCase == "-loadsinglestrict")
     {
       Standard_Integer anIndexToSingleLoad = -1;
@@ -1748,6 +1779,7 @@ void MeshTest1::Commands(DrawInterpreter& theCommands)
                   "\n\t\t:   [-load {-1|Index|ALL}=-1] [-unload {-1|Index|ALL}=-1]"
                   "\n\t\t:   [-activate Index] [-activateExact Index]"
                   "\n\t\t:   [-loadSingle {-1|Index}=-1] [-loadSingleExact {Index}=-1]"
+                  "\n\t\t:   [-loadBudget Bytes]"
                   "\n\t\t: Interaction with deferred triangulations."
                   "\n\t\t:   '-load'            - load triangulation (-1 - currently active one, "
                   "Index - with defined index,"
@@ -1768,7 +1800,11 @@ void MeshTest1::Commands(DrawInterpreter& theCommands)
                   "\n\t\t:   '-loadSingleExact' - make loaded and active ONLY exactly specified "
                   "triangulation. All other triangulations"
                   "\n\t\t:                      will be unloaded. If triangulation with such Index "
-                  "doesn't exist do nothing",
+                  "doesn't exist do nothing"
+                  "\n\t\t:   '-loadBudget'      - load active triangulations of faces one by one "
+                  "unloading the least"
+                  "\n\t\t:                      recently loaded ones to keep the memory budget "
+                  "(0 - no limit).",
                   __FILE__,
                   TrLateLoad,
                   g);
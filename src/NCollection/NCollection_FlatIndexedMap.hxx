@@ -0,0 +1,459 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef NCollection_FlatIndexedMap_HeaderFile
+#define NCollection_FlatIndexedMap_HeaderFile
+
+#include <NCollection_Array1.hxx>
+#include <NCollection_DefaultHasher.hxx>
+#include <NCollection_StlIterator.hxx>
+#include <Standard_NoSuchObject.hxx>
+#include <Standard_OutOfRange.hxx>
+
+#include <utility>
+
+/**
+ * Purpose:     An indexed map with flat storage, an alternative to
+ *              NCollection_IndexedMap having the same semantics of
+ *              indices: each new key gets the index Extent() + 1,
+ *              the keys can be found by index and the index by key.
+ *
+ *              The keys and their hash codes are stored in contiguous
+ *              arrays ordered by index, and the hash table is an array
+ *              of indices with open addressing (linear probing), thus
+ *              no memory is allocated per key and the lookup does not
+ *              follow the chains of nodes.
+ *
+ *              The removal of a key other than the last one moves
+ *              the last key to the place of the removed one,
+ *              as NCollection_IndexedMap::RemoveFromIndex() does.
+ *              The references to the keys are invalidated on adding
+ *              new keys when the storage grows.
+ */
+template <class TheKeyType, class Hasher1 = DefaultHasher<TheKeyType>>
+class NCollection_FlatIndexedMap
+{
+public:
+  //! STL-compliant typedef for key type
+  typedef TheKeyType key_type;
+  typedef Hasher1    hasher;
+
+public:
+  // **************** Implementation of the Iterator interface.
+  class Iterator
+  {
+  public:
+    //! Empty constructor
+    Iterator(void)
+        : myMap(NULL),
+          myIndex(0)
+    {
+    }
+
+    //! Constructor
+    Iterator(const NCollection_FlatIndexedMap& theMap)
+        : myMap(&theMap),
+          myIndex(1)
+    {
+    }
+
+    //! Query if the end of collection is reached by iterator
+    Standard_Boolean More(void) const { return (myMap != NULL) && (myIndex <= myMap->Extent()); }
+
+    //! Make a step along the collection
+    void Next(void) { myIndex++; }
+
+    //! Value access
+    const TheKeyType& Value(void) const
+    {
+      Standard_NoSuchObject_Raise_if(!More(), "NCollection_FlatIndexedMap::Iterator::Value");
+      return myMap->FindKey(myIndex);
+    }
+
+    //! Performs comparison of two iterators.
+    Standard_Boolean IsEqual(const Iterator& theOther) const
+    {
+      return myMap == theOther.myMap && myIndex == theOther.myIndex;
+    }
+
+  private:
+    const NCollection_FlatIndexedMap* myMap;   // Pointer to the map being iterated
+    Standard_Integer                  myIndex; // Current index
+  };
+
+  //! Shorthand for a constant iterator type.
+  typedef NCollection_StlIterator<std::forward_iterator_tag, Iterator, TheKeyType, true>
+    const_iterator;
+
+  //! Returns a const iterator pointing to the first element in the map.
+  const_iterator cbegin() const { return Iterator(*this); }
+
+  //! Returns a const iterator referring to the past-the-end element in the map.
+  const_iterator cend() const { return Iterator(); }
+
+public:
+  // ---------- PUBLIC METHODS ------------
+
+  //! Empty constructor.
+  NCollection_FlatIndexedMap()
+      : myExtent(0)
+  {
+  }
+
+  //! Constructor reserving the storage for the number of keys.
+  explicit NCollection_FlatIndexedMap(const Standard_Integer theNbKeys)
+      : myExtent(0)
+  {
+    ReSize(theNbKeys);
+  }
+
+  //! Copy constructor
+  NCollection_FlatIndexedMap(const NCollection_FlatIndexedMap& theOther)
+      : myKeys(theOther.myKeys),
+        myHashes(theOther.myHashes),
+        mySlots(theOther.mySlots),
+        myExtent(theOther.myExtent),
+        myHasher(theOther.myHasher)
+  {
+  }
+
+  //! Move constructor, the other map becomes empty.
+  NCollection_FlatIndexedMap(NCollection_FlatIndexedMap&& theOther) noexcept
+      : myExtent(0)
+  {
+    Exchange(theOther);
+  }
+
+  //! Exchange the content of two maps without re-allocations.
+  void Exchange(NCollection_FlatIndexedMap& theOther) noexcept
+  {
+    std::swap(myKeys, theOther.myKeys);
+    std::swap(myHashes, theOther.myHashes);
+    std::swap(mySlots, theOther.mySlots);
+    std::swap(myExtent, theOther.myExtent);
+    std::swap(myHasher, theOther.myHasher);
+  }
+
+  //! Assign.
+  //! This method does not change the internal allocator.
+  NCollection_FlatIndexedMap& Assign(const NCollection_FlatIndexedMap& theOther)
+  {
+    if (this != &theOther)
+    {
+      myKeys   = NCollection_Array1<TheKeyType>(theOther.myKeys);
+      myHashes = NCollection_Array1<size_t>(theOther.myHashes);
+      mySlots  = NCollection_Array1<Standard_Integer>(theOther.mySlots);
+      myExtent = theOther.myExtent;
+    }
+    return *this;
+  }
+
+  //! Assignment operator
+  NCollection_FlatIndexedMap& operator=(const NCollection_FlatIndexedMap& theOther)
+  {
+    return Assign(theOther);
+  }
+
+  //! Move operator, the other map becomes empty.
+  NCollection_FlatIndexedMap& operator=(NCollection_FlatIndexedMap&& theOther) noexcept
+  {
+    if (this != &theOther)
+    {
+      Clear(Standard_True);
+      Exchange(theOther);
+    }
+    return *this;
+  }
+
+  //! Reserves the storage for the number of keys.
+  void ReSize(const Standard_Integer theNbKeys)
+  {
+    if (theNbKeys > myKeys.Size())
+    {
+      reserve(theNbKeys);
+    }
+  }
+
+  //! Add the key and return its index.
+  //! If the key is already in the map, its index is returned.
+  Standard_Integer Add(const TheKeyType& theKey1)
+  {
+    const size_t           aHash  = hashCode(theKey1);
+    const Standard_Integer anIndex = findIndex(theKey1, aHash);
+    if (anIndex != 0)
+    {
+      return anIndex;
+    }
+    const Standard_Integer aNewIndex = appendHash(aHash);
+    myKeys(aNewIndex)                = theKey1;
+    return aNewIndex;
+  }
+
+  //! Add the key and return its index.
+  //! If the key is already in the map, its index is returned.
+  Standard_Integer Add(TheKeyType&& theKey1)
+  {
+    const size_t           aHash  = hashCode(theKey1);
+    const Standard_Integer anIndex = findIndex(theKey1, aHash);
+    if (anIndex != 0)
+    {
+      return anIndex;
+    }
+    const Standard_Integer aNewIndex = appendHash(aHash);
+    myKeys(aNewIndex)                = std::forward<TheKeyType>(theKey1);
+    return aNewIndex;
+  }
+
+  //! Contains
+  Standard_Boolean Contains(const TheKeyType& theKey1) const
+  {
+    return findIndex(theKey1, hashCode(theKey1)) != 0;
+  }
+
+  //! Returns the index of the key, 0 if it is not in the map.
+  Standard_Integer FindIndex(const TheKeyType& theKey1) const
+  {
+    return findIndex(theKey1, hashCode(theKey1));
+  }
+
+  //! Returns the pointer to the key stored in the map, NULL if it is not in the map.
+  const TheKeyType* Seek(const TheKeyType& theKey1) const
+  {
+    const Standard_Integer anIndex = findIndex(theKey1, hashCode(theKey1));
+    return anIndex != 0 ? &myKeys(anIndex) : NULL;
+  }
+
+  //! FindKey
+  const TheKeyType& FindKey(const Standard_Integer theIndex) const
+  {
+    Standard_OutOfRange_Raise_if(theIndex < 1 || theIndex > myExtent,
+                                 "NCollection_FlatIndexedMap::FindKey");
+    return myKeys(theIndex);
+  }
+
+  //! operator ()
+  const TheKeyType& operator()(const Standard_Integer theIndex) const { return FindKey(theIndex); }
+
+  //! RemoveLast
+  void RemoveLast(void)
+  {
+    Standard_OutOfRange_Raise_if(myExtent == 0, "NCollection_FlatIndexedMap::RemoveLast");
+    eraseSlot(findSlot(myExtent));
+    myKeys(myExtent) = TheKeyType();
+    --myExtent;
+  }
+
+  //! Remove the key of the given index.
+  //! Caution! The index of the last key will be changed to the given one.
+  void RemoveFromIndex(const Standard_Integer theIndex)
+  {
+    Standard_OutOfRange_Raise_if(theIndex < 1 || theIndex > myExtent,
+                                 "NCollection_FlatIndexedMap::RemoveFromIndex");
+    if (theIndex != myExtent)
+    {
+      eraseSlot(findSlot(theIndex));
+      // the last key takes the place of the removed one
+      mySlots(findSlot(myExtent)) = theIndex;
+      myKeys(theIndex)            = std::move(myKeys(myExtent));
+      myHashes(theIndex)          = myHashes(myExtent);
+      myKeys(myExtent)            = TheKeyType();
+      --myExtent;
+      return;
+    }
+    RemoveLast();
+  }
+
+  //! Remove the given key.
+  //! Caution! The index of the last key will be changed to the index of the removed key.
+  Standard_Boolean RemoveKey(const TheKeyType& theKey1)
+  {
+    const Standard_Integer anIndex = FindIndex(theKey1);
+    if (anIndex == 0)
+    {
+      return Standard_False;
+    }
+    RemoveFromIndex(anIndex);
+    return Standard_True;
+  }
+
+  //! Clear data. If doReleaseMemory is false then the storage is kept for reuse.
+  void Clear(const Standard_Boolean doReleaseMemory = Standard_False)
+  {
+    if (doReleaseMemory)
+    {
+      myKeys   = NCollection_Array1<TheKeyType>();
+      myHashes = NCollection_Array1<size_t>();
+      mySlots  = NCollection_Array1<Standard_Integer>();
+    }
+    else
+    {
+      for (Standard_Integer anIndex = 1; anIndex <= myExtent; ++anIndex)
+      {
+        myKeys(anIndex) = TheKeyType();
+      }
+      if (!mySlots.IsEmpty())
+      {
+        mySlots.Init(0);
+      }
+    }
+    myExtent = 0;
+  }
+
+  //! Extent
+  Standard_Integer Extent(void) const { return myExtent; }
+
+  //! Size
+  Standard_Integer Size(void) const { return myExtent; }
+
+  //! IsEmpty
+  Standard_Boolean IsEmpty(void) const { return myExtent == 0; }
+
+  //! Returns the number of keys which can be stored without re-allocation.
+  Standard_Integer Capacity(void) const { return myKeys.Size(); }
+
+private:
+  // ----------- PRIVATE METHODS -----------
+
+  //! Returns the hash code of the key, with the bits mixed for the masking by the table size.
+  size_t hashCode(const TheKeyType& theKey) const
+  {
+    size_t aHash = myHasher(theKey);
+    aHash ^= aHash >> 15;
+    aHash *= static_cast<size_t>(0x2c1b3c6dU);
+    aHash ^= aHash >> 12;
+    aHash *= static_cast<size_t>(0x297a2d39U);
+    aHash ^= aHash >> 15;
+    return aHash;
+  }
+
+  //! Returns the index of the key with the hash code, 0 if it is not in the map.
+  Standard_Integer findIndex(const TheKeyType& theKey, const size_t theHash) const
+  {
+    if (myExtent == 0)
+    {
+      return 0;
+    }
+    const size_t aMask = static_cast<size_t>(mySlots.Size() - 1);
+    for (size_t aSlot = theHash & aMask;; aSlot = (aSlot + 1) & aMask)
+    {
+      const Standard_Integer anIndex = mySlots(static_cast<Standard_Integer>(aSlot));
+      if (anIndex == 0)
+      {
+        return 0;
+      }
+      if (myHashes(anIndex) == theHash && myHasher(myKeys(anIndex), theKey))
+      {
+        return anIndex;
+      }
+    }
+  }
+
+  //! Returns the slot of the hash table referring to the key with the index.
+  Standard_Integer findSlot(const Standard_Integer theIndex) const
+  {
+    const size_t aMask = static_cast<size_t>(mySlots.Size() - 1);
+    size_t       aSlot = myHashes(theIndex) & aMask;
+    while (mySlots(static_cast<Standard_Integer>(aSlot)) != theIndex)
+    {
+      aSlot = (aSlot + 1) & aMask;
+    }
+    return static_cast<Standard_Integer>(aSlot);
+  }
+
+  //! Puts the index into the first free slot for the hash code.
+  void insertSlot(const size_t theHash, const Standard_Integer theIndex)
+  {
+    const size_t aMask = static_cast<size_t>(mySlots.Size() - 1);
+    size_t       aSlot = theHash & aMask;
+    while (mySlots(static_cast<Standard_Integer>(aSlot)) != 0)
+    {
+      aSlot = (aSlot + 1) & aMask;
+    }
+    mySlots(static_cast<Standard_Integer>(aSlot)) = theIndex;
+  }
+
+  //! Frees the slot shifting back the following slots of the same probe sequence.
+  void eraseSlot(const Standard_Integer theSlot)
+  {
+    const size_t aMask = static_cast<size_t>(mySlots.Size() - 1);
+    size_t       aHole = static_cast<size_t>(theSlot);
+    for (size_t aSlot = (aHole + 1) & aMask;; aSlot = (aSlot + 1) & aMask)
+    {
+      const Standard_Integer anIndex = mySlots(static_cast<Standard_Integer>(aSlot));
+      if (anIndex == 0)
+      {
+        break;
+      }
+      // the key may fill the hole if its home slot is not between the hole and its slot
+      const size_t aHome = myHashes(anIndex) & aMask;
+      if (((aSlot - aHome) & aMask) >= ((aSlot - aHole) & aMask))
+      {
+        mySlots(static_cast<Standard_Integer>(aHole)) = anIndex;
+        aHole                                         = aSlot;
+      }
+    }
+    mySlots(static_cast<Standard_Integer>(aHole)) = 0;
+  }
+
+  //! Appends the hash code of the new key and returns its index.
+  Standard_Integer appendHash(const size_t theHash)
+  {
+    if (myExtent == myKeys.Size())
+    {
+      reserve(myExtent < 8 ? 8 : 2 * myExtent);
+    }
+    ++myExtent;
+    myHashes(myExtent) = theHash;
+    insertSlot(theHash, myExtent);
+    return myExtent;
+  }
+
+  //! Re-allocates the storage for the number of keys and rebuilds the hash table.
+  void reserve(const Standard_Integer theNbKeys)
+  {
+    NCollection_Array1<TheKeyType> aKeys(1, theNbKeys);
+    NCollection_Array1<size_t>     aHashes(1, theNbKeys);
+    for (Standard_Integer anIndex = 1; anIndex <= myExtent; ++anIndex)
+    {
+      aKeys(anIndex)   = std::move(myKeys(anIndex));
+      aHashes(anIndex) = myHashes(anIndex);
+    }
+    myKeys   = std::move(aKeys);
+    myHashes = std::move(aHashes);
+
+    // keep the load factor of the hash table not greater than 1/2
+    Standard_Integer aNbSlots = 16;
+    while (aNbSlots < 2 * theNbKeys)
+    {
+      aNbSlots *= 2;
+    }
+    if (aNbSlots != mySlots.Size())
+    {
+      mySlots = NCollection_Array1<Standard_Integer>(0, aNbSlots - 1);
+      mySlots.Init(0);
+      for (Standard_Integer anIndex = 1; anIndex <= myExtent; ++anIndex)
+      {
+        insertSlot(myHashes(anIndex), anIndex);
+      }
+    }
+  }
+
+private:
+  NCollection_Array1<TheKeyType>       myKeys;   //!< keys ordered by indices (capacity)
+  NCollection_Array1<size_t>           myHashes; //!< mixed hash codes of the keys
+  NCollection_Array1<Standard_Integer> mySlots;  //!< hash table of indices, 0 for free slot
+  Standard_Integer                     myExtent; //!< number of keys
+  Hasher1                              myHasher;
+};
+
+#endif
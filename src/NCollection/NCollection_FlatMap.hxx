@@ -0,0 +1,166 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef NCollection_FlatMap_HeaderFile
+#define NCollection_FlatMap_HeaderFile
+
+#include <NCollection_FlatIndexedMap.hxx>
+
+/**
+ * Purpose:     A map of keys with flat storage, an alternative to
+ *              NCollection_Map with the same interface for adding,
+ *              searching, removing and iterating the keys.
+ *
+ *              The keys are stored contiguously and hashed with open
+ *              addressing, see NCollection_FlatIndexedMap. The keys
+ *              are iterated in the order of addition, unless some
+ *              of them are removed: the removed key is replaced by
+ *              the last one. It is not wise to iterate and modify
+ *              a map in parallel.
+ */
+template <class TheKeyType, class Hasher1 = DefaultHasher<TheKeyType>>
+class NCollection_FlatMap
+{
+public:
+  //! STL-compliant typedef for key type
+  typedef TheKeyType key_type;
+  typedef Hasher1    hasher;
+
+public:
+  //!   Implementation of the Iterator interface.
+  class Iterator
+  {
+  public:
+    //! Empty constructor
+    Iterator(void)
+        : myMap(NULL),
+          myIndex(0)
+    {
+    }
+
+    //! Constructor
+    Iterator(const NCollection_FlatMap& theMap)
+        : myMap(&theMap.myMap),
+          myIndex(1)
+    {
+    }
+
+    //! Query if the end of collection is reached by iterator
+    Standard_Boolean More(void) const { return (myMap != NULL) && (myIndex <= myMap->Extent()); }
+
+    //! Make a step along the collection
+    void Next(void) { myIndex++; }
+
+    //! Value inquiry
+    const TheKeyType& Value(void) const
+    {
+      Standard_NoSuchObject_Raise_if(!More(), "NCollection_FlatMap::Iterator::Value");
+      return myMap->FindKey(myIndex);
+    }
+
+    //! Key
+    const TheKeyType& Key(void) const { return Value(); }
+
+    //! Performs comparison of two iterators.
+    Standard_Boolean IsEqual(const Iterator& theOther) const
+    {
+      return myMap == theOther.myMap && myIndex == theOther.myIndex;
+    }
+
+  private:
+    const NCollection_FlatIndexedMap<TheKeyType, Hasher1>* myMap;   // the keys being iterated
+    Standard_Integer                                       myIndex; // Current index
+  };
+
+  //! Shorthand for a constant iterator type.
+  typedef NCollection_StlIterator<std::forward_iterator_tag, Iterator, TheKeyType, true>
+    const_iterator;
+
+  //! Returns a const iterator pointing to the first element in the map.
+  const_iterator cbegin() const { return Iterator(*this); }
+
+  //! Returns a const iterator referring to the past-the-end element in the map.
+  const_iterator cend() const { return Iterator(); }
+
+public:
+  // ---------- PUBLIC METHODS ------------
+
+  //! Empty constructor.
+  NCollection_FlatMap() {}
+
+  //! Constructor reserving the storage for the number of keys.
+  explicit NCollection_FlatMap(const Standard_Integer theNbKeys)
+      : myMap(theNbKeys)
+  {
+  }
+
+  //! Exchange the content of two maps without re-allocations.
+  void Exchange(NCollection_FlatMap& theOther) { myMap.Exchange(theOther.myMap); }
+
+  //! Assign.
+  NCollection_FlatMap& Assign(const NCollection_FlatMap& theOther)
+  {
+    myMap.Assign(theOther.myMap);
+    return *this;
+  }
+
+  //! Reserves the storage for the number of keys.
+  void ReSize(const Standard_Integer theNbKeys) { myMap.ReSize(theNbKeys); }
+
+  //! Add the key, returns false if it is already in the map.
+  Standard_Boolean Add(const TheKeyType& theKey)
+  {
+    const Standard_Integer anExtent = myMap.Extent();
+    return myMap.Add(theKey) > anExtent;
+  }
+
+  //! Add the key, returns false if it is already in the map.
+  Standard_Boolean Add(TheKeyType&& theKey)
+  {
+    const Standard_Integer anExtent = myMap.Extent();
+    return myMap.Add(std::forward<TheKeyType>(theKey)) > anExtent;
+  }
+
+  //! Added: add a new key if not yet in the map, and return
+  //! reference to either newly added or previously existing object
+  const TheKeyType& Added(const TheKeyType& theKey) { return myMap.FindKey(myMap.Add(theKey)); }
+
+  //! Contains
+  Standard_Boolean Contains(const TheKeyType& theKey) const { return myMap.Contains(theKey); }
+
+  //! Returns the pointer to the key stored in the map, NULL if it is not in the map.
+  const TheKeyType* Seek(const TheKeyType& theKey) const { return myMap.Seek(theKey); }
+
+  //! Remove
+  Standard_Boolean Remove(const TheKeyType& theKey) { return myMap.RemoveKey(theKey); }
+
+  //! Clear data. If doReleaseMemory is false then the storage is kept for reuse.
+  void Clear(const Standard_Boolean doReleaseMemory = Standard_False)
+  {
+    myMap.Clear(doReleaseMemory);
+  }
+
+  //! Extent
+  Standard_Integer Extent(void) const { return myMap.Extent(); }
+
+  //! Size
+  Standard_Integer Size(void) const { return myMap.Extent(); }
+
+  //! IsEmpty
+  Standard_Boolean IsEmpty(void) const { return myMap.IsEmpty(); }
+
+private:
+  NCollection_FlatIndexedMap<TheKeyType, Hasher1> myMap;
+};
+
+#endif
@@ -300,6 +300,18 @@ public: //! @name public methods
   //! Returns number of logical processors.
   Standard_EXPORT static Standard_Integer NbLogicalProcessors();
 
+  //! Returns TRUE if the loops are always executed by the calling thread,
+  //! which is the case when OCCT is built with a non-atomic reference counter
+  //! (OCCT_NONATOMIC_REFCOUNT macro, see BUILD_NONATOMIC_REFCOUNT CMake option).
+  static Standard_Boolean IsSingleThreadOnly()
+  {
+#ifdef OCCT_NONATOMIC_REFCOUNT
+    return Standard_True;
+#else
+    return Standard_False;
+#endif
+  }
+
   //! Simple primitive for parallelization of "foreach" loops, equivalent to:
   //! @code
   //!   for (auto anIter = theBegin; anIter != theEnd; ++anIter) {
@@ -319,7 +331,7 @@ public: //! @name public methods
                       const Standard_Boolean isForceSingleThreadExecution = Standard_False,
                       Standard_Integer       theNbItems                   = -1)
   {
-    if (isForceSingleThreadExecution || theNbItems == 1)
+    if (isForceSingleThreadExecution || theNbItems == 1 || IsSingleThreadOnly())
     {
       for (InputIterator it(theBegin); it != theEnd; ++it)
         theFunctor(*it);
@@ -358,7 +370,7 @@ public: //! @name public methods
                   const Standard_Boolean isForceSingleThreadExecution = Standard_False)
   {
     const Standard_Integer aRange = theEnd - theBegin;
-    if (isForceSingleThreadExecution || aRange == 1)
+    if (isForceSingleThreadExecution || aRange == 1 || IsSingleThreadOnly())
     {
       for (Standard_Integer it(theBegin); it != theEnd; ++it)
         theFunctor(it);
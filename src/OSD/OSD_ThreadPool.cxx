@@ -320,9 +320,13 @@ OSD_ThreadPool::Launcher::Launcher(OSD_ThreadPool& thePool, Standard_Integer the
     : mySelfThread(true),
       myNbThreads(0)
 {
-  const int aNbThreads = theMaxThreads > 0
-                           ? Min(theMaxThreads, thePool.NbThreads())
-                           : (theMaxThreads < 0 ? Max(thePool.NbDefaultThreadsToLaunch(), 1) : 1);
+  int aNbThreads = theMaxThreads > 0
+                     ? Min(theMaxThreads, thePool.NbThreads())
+                     : (theMaxThreads < 0 ? Max(thePool.NbDefaultThreadsToLaunch(), 1) : 1);
+#ifdef OCCT_NONATOMIC_REFCOUNT
+  // handles cannot be shared between threads, the job is executed by the calling thread only
+  aNbThreads = 1;
+#endif
   myThreads.Resize(0, aNbThreads - 1, false);
   myThreads.Init(NULL);
   if (aNbThreads > 1)
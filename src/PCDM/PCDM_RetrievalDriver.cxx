@@ -54,3 +54,10 @@ UtfString PCDM_RetrievalDriver::GetFormat() const
 {
   return myFormat;
 }
+
+//=================================================================================================
+
+Handle(PCDM_RetrievalDriver) PCDM_RetrievalDriver::Copy() const
+{
+  return Handle(PCDM_RetrievalDriver)();
+}
@@ -23,6 +23,7 @@
 #include <PCDM_Reader.hxx>
 #include <PCDM_ReferenceIterator.hxx>
 #include <PCDM_SequenceOfReference.hxx>
+#include <Standard_Mutex.hxx>
 
 class CDM_MetaData;
 class Message_Messenger;
@@ -47,6 +48,14 @@ public:
 
   Standard_EXPORT UtfString GetFormat() const;
 
+  //! Returns a new driver of the same type and with the same settings,
+  //! to be used for reading another document while this driver is busy.
+  //! Default implementation returns NULL, so that such operations wait for this driver.
+  Standard_EXPORT virtual Handle(PCDM_RetrievalDriver) Copy() const;
+
+  //! Returns the mutex locked while the driver is used by a reading operation.
+  Standard_Mutex& Mutex() { return myMutex; }
+
   DEFINE_STANDARD_RTTIEXT(PCDM_RetrievalDriver, Reader1)
 
 private:
@@ -55,6 +64,7 @@ private:
                                          const Handle(Message_Messenger)&  theMsgDriver);
 
   UtfString myFormat;
+  Standard_Mutex            myMutex;
 };
 
 #endif // _PCDM_RetrievalDriver_HeaderFile
@@ -166,3 +166,10 @@ void PCDM_StorageDriver::SetStoreStatus(const PCDM_StoreStatus theStoreStatus)
 {
   myStoreStatus = theStoreStatus;
 }
+
+//=================================================================================================
+
+Handle(PCDM_StorageDriver) PCDM_StorageDriver::Copy() const
+{
+  return Handle(PCDM_StorageDriver)();
+}
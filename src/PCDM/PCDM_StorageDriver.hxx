@@ -24,6 +24,7 @@
 #include <PCDM_StoreStatus.hxx>
 #include <PCDM_Writer.hxx>
 #include <PCDM_SequenceOfDocument.hxx>
+#include <Standard_Mutex.hxx>
 class PCDM_Document;
 class CDM_Document;
 
@@ -85,6 +86,14 @@ public:
 
   Standard_EXPORT void SetStoreStatus(const PCDM_StoreStatus theStoreStatus);
 
+  //! Returns a new driver of the same type and with the same settings,
+  //! to be used for writing another document while this driver is busy.
+  //! Default implementation returns NULL, so that such operations wait for this driver.
+  Standard_EXPORT virtual Handle(PCDM_StorageDriver) Copy() const;
+
+  //! Returns the mutex locked while the driver is used by a writing operation.
+  Standard_Mutex& Mutex() { return myMutex; }
+
   DEFINE_STANDARD_RTTIEXT(PCDM_StorageDriver, Writer1)
 
 protected:
@@ -92,6 +101,7 @@ private:
   UtfString myFormat;
   Standard_Boolean           myIsError;
   PCDM_StoreStatus           myStoreStatus;
+  Standard_Mutex             myMutex;
 };
 
 #endif // _PCDM_StorageDriver_HeaderFile
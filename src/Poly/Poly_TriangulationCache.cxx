@@ -0,0 +1,301 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Poly_TriangulationCache.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(Poly_TriangulationCache, RefObject)
+
+//=================================================================================================
+
+Poly_TriangulationCache::Poly_TriangulationCache(const Standard_Size           theBudget,
+                                                 const Handle(OSD_FileSystem)& theFileSystem)
+    : myFileSystem(!theFileSystem.IsNull() ? theFileSystem : OSD_FileSystem::DefaultFileSystem()),
+      myFirst(NULL),
+      myLast(NULL),
+      myBudget(theBudget),
+      myLoadedSize(0),
+      myNbHits(0),
+      myNbLoads(0),
+      myNbEvictions(0)
+{
+}
+
+//=================================================================================================
+
+void Poly_TriangulationCache::SetBudget(const Standard_Size theBudget)
+{
+  Standard_Mutex::Sentry aSentry(myMutex);
+  myBudget = theBudget;
+  evict();
+}
+
+//=================================================================================================
+
+Standard_Boolean Poly_TriangulationCache::Load(const Handle(MeshTriangulation)& theTriangulation)
+{
+  if (theTriangulation.IsNull())
+  {
+    return Standard_False;
+  }
+
+  return load(theTriangulation, Standard_False);
+}
+
+//=================================================================================================
+
+Standard_Boolean Poly_TriangulationCache::Pin(const Handle(MeshTriangulation)& theTriangulation)
+{
+  if (theTriangulation.IsNull())
+  {
+    return Standard_False;
+  }
+
+  return load(theTriangulation, Standard_True);
+}
+
+//=================================================================================================
+
+void Poly_TriangulationCache::Unpin(const Handle(MeshTriangulation)& theTriangulation)
+{
+  Standard_Mutex::Sentry aSentry(myMutex);
+  Entry*                 anEntry = myEntries.ChangeSeek(theTriangulation);
+  if (anEntry != NULL && anEntry->NbPins > 0 && --anEntry->NbPins == 0)
+  {
+    // the budget could not be kept while the triangulation was pinned
+    evict();
+  }
+}
+
+//=================================================================================================
+
+Standard_Boolean Poly_TriangulationCache::Unload(const Handle(MeshTriangulation)& theTriangulation)
+{
+  Standard_Mutex::Sentry aSentry(myMutex);
+  Entry*                 anEntry = myEntries.ChangeSeek(theTriangulation);
+  if (anEntry == NULL || anEntry->NbPins > 0)
+  {
+    return Standard_False;
+  }
+  unload(anEntry);
+  return Standard_True;
+}
+
+//=================================================================================================
+
+Standard_Boolean Poly_TriangulationCache::IsLoaded(
+  const Handle(MeshTriangulation)& theTriangulation) const
+{
+  Standard_Mutex::Sentry aSentry(myMutex);
+  return myEntries.IsBound(theTriangulation);
+}
+
+//=================================================================================================
+
+void Poly_TriangulationCache::Clear()
+{
+  Standard_Mutex::Sentry aSentry(myMutex);
+  for (Entry* anEntry = myFirst; anEntry != NULL;)
+  {
+    Entry* aNext = anEntry->Next;
+    if (anEntry->NbPins == 0)
+    {
+      unload(anEntry);
+    }
+    anEntry = aNext;
+  }
+}
+
+//=================================================================================================
+
+Standard_Integer Poly_TriangulationCache::NbLoaded() const
+{
+  Standard_Mutex::Sentry aSentry(myMutex);
+  return myEntries.Extent();
+}
+
+//=================================================================================================
+
+Standard_Size Poly_TriangulationCache::LoadedSize() const
+{
+  Standard_Mutex::Sentry aSentry(myMutex);
+  return myLoadedSize;
+}
+
+//=================================================================================================
+
+void Poly_TriangulationCache::ResetStatistics()
+{
+  myNbHits      = 0;
+  myNbLoads     = 0;
+  myNbEvictions = 0;
+}
+
+//=================================================================================================
+
+Standard_Size Poly_TriangulationCache::DataSize(const Handle(MeshTriangulation)& theTriangulation)
+{
+  Standard_Size aSize = theTriangulation->InternalNodes().SizeBytes()
+                        + theTriangulation->NbTriangles() * sizeof(Triangle2);
+  if (theTriangulation->HasUVNodes())
+  {
+    aSize += theTriangulation->InternalUVNodes().SizeBytes();
+  }
+  if (theTriangulation->HasNormals())
+  {
+    aSize += theTriangulation->NbNodes() * sizeof(gp_Vec3f);
+  }
+  return aSize;
+}
+
+//=================================================================================================
+
+Standard_Boolean Poly_TriangulationCache::load(const Handle(MeshTriangulation)& theTriangulation,
+                                               const Standard_Boolean           theToPin)
+{
+  Standard_Integer aNbPins = theToPin ? 1 : 0;
+  {
+    Standard_Mutex::Sentry aSentry(myMutex);
+    if (touch(theTriangulation, aNbPins))
+    {
+      return Standard_True;
+    }
+  }
+
+  // the data is read without blocking the other triangulations
+  if (!theTriangulation->HasDeferredData())
+  {
+    return Standard_False;
+  }
+  Handle(MeshTriangulation) aLoaded = theTriangulation->DetachedLoadDeferredData(myFileSystem);
+  if (aLoaded.IsNull())
+  {
+    return Standard_False;
+  }
+
+  Standard_Mutex::Sentry aSentry(myMutex);
+  if (touch(theTriangulation, aNbPins))
+  {
+    // another thread has loaded the same triangulation first
+    return Standard_True;
+  }
+
+  theTriangulation->InternalNodes().Move(aLoaded->InternalNodes());
+  theTriangulation->InternalTriangles().Move(aLoaded->InternalTriangles());
+  theTriangulation->InternalUVNodes().Move(aLoaded->InternalUVNodes());
+  theTriangulation->InternalNormals().Move(aLoaded->InternalNormals());
+  theTriangulation->SetMeshPurpose(theTriangulation->MeshPurpose() | Poly_MeshPurpose_Loaded);
+  ++myNbLoads;
+
+  Entry anEntry;
+  anEntry.Triangulation = theTriangulation;
+  anEntry.Size          = DataSize(theTriangulation);
+  anEntry.NbPins        = aNbPins;
+  link(myEntries.Bound(theTriangulation, anEntry));
+  myLoadedSize += anEntry.Size;
+  evict();
+  return Standard_True;
+}
+
+//=================================================================================================
+
+Standard_Boolean Poly_TriangulationCache::touch(const Handle(MeshTriangulation)& theTriangulation,
+                                                Standard_Integer&                theNbPins)
+{
+  Entry* anEntry = myEntries.ChangeSeek(theTriangulation);
+  if (anEntry == NULL)
+  {
+    return Standard_False;
+  }
+  if (!theTriangulation->HasGeometry())
+  {
+    // the data has been unloaded by other means, it is loaded again keeping the pins
+    theNbPins += anEntry->NbPins;
+    unload(anEntry);
+    return Standard_False;
+  }
+
+  // move the triangulation to the end of the queue
+  unlink(anEntry);
+  link(anEntry);
+  anEntry->NbPins += theNbPins;
+  ++myNbHits;
+  return Standard_True;
+}
+
+//=================================================================================================
+
+void Poly_TriangulationCache::link(Entry* theEntry)
+{
+  theEntry->Previous = myLast;
+  theEntry->Next     = NULL;
+  if (myLast != NULL)
+  {
+    myLast->Next = theEntry;
+  }
+  else
+  {
+    myFirst = theEntry;
+  }
+  myLast = theEntry;
+}
+
+//=================================================================================================
+
+void Poly_TriangulationCache::unlink(Entry* theEntry)
+{
+  if (theEntry->Previous != NULL)
+  {
+    theEntry->Previous->Next = theEntry->Next;
+  }
+  else
+  {
+    myFirst = theEntry->Next;
+  }
+  if (theEntry->Next != NULL)
+  {
+    theEntry->Next->Previous = theEntry->Previous;
+  }
+  else
+  {
+    myLast = theEntry->Previous;
+  }
+}
+
+//=================================================================================================
+
+void Poly_TriangulationCache::evict()
+{
+  for (Entry* anEntry = myFirst;
+       anEntry != myLast && myBudget != 0 && myLoadedSize > myBudget;)
+  {
+    Entry* aNext = anEntry->Next;
+    if (anEntry->NbPins == 0)
+    {
+      unload(anEntry);
+      ++myNbEvictions;
+    }
+    anEntry = aNext;
+  }
+}
+
+//=================================================================================================
+
+void Poly_TriangulationCache::unload(Entry* theEntry)
+{
+  // the handle is kept since the entry is destroyed on unbinding
+  Handle(MeshTriangulation) aTriangulation = theEntry->Triangulation;
+  myLoadedSize -= theEntry->Size;
+  unlink(theEntry);
+  myEntries.UnBind(aTriangulation);
+  aTriangulation->UnloadDeferredData();
+}
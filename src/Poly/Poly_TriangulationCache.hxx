@@ -0,0 +1,201 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _Poly_TriangulationCache_HeaderFile
+#define _Poly_TriangulationCache_HeaderFile
+
+#include <NCollection_DataMap.hxx>
+#include <OSD_FileSystem.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Standard_Mutex.hxx>
+
+#include <atomic>
+
+DEFINE_STANDARD_HANDLE(Poly_TriangulationCache, RefObject)
+
+//! Keeps the data of deferred triangulations (see MeshTriangulation::HasDeferredData())
+//! in memory within the given budget of bytes.
+//!
+//! The triangulations are loaded on access through Load(), and the least recently
+//! accessed ones are unloaded as soon as the total size of the loaded data exceeds the budget.
+//! An unloaded triangulation keeps its deferred storage, so that it is loaded again
+//! by the next call of Load(). The cache is intended to be shared by all the triangulations
+//! of a document (or of several ones); its methods can be called from different threads.
+//!
+//! Only triangulations loaded through the cache are taken into account, the budget
+//! does not limit the data loaded by other means.
+//!
+//! Since a concurrent Load() may unload any other triangulation which is not in use,
+//! the data should be accessed while it is pinned by Pin() / Unpin() or by Sentry:
+//! @code
+//!   Poly_TriangulationCache::Sentry aLoaded(aCache, aTriangulation);
+//!   if (aLoaded.IsLoaded())
+//!   {
+//!     // nodes and triangles of aTriangulation are kept in memory within this scope
+//!   }
+//! @endcode
+class Poly_TriangulationCache : public RefObject
+{
+public:
+  //! Creates an empty cache.
+  //! @param[in] theBudget      maximum size of the loaded data in bytes, 0 means no limit
+  //! @param[in] theFileSystem  file system to load the deferred data,
+  //!                           OSD_FileSystem::DefaultFileSystem() is used if it is NULL
+  Standard_EXPORT Poly_TriangulationCache(
+    const Standard_Size           theBudget     = 0,
+    const Handle(OSD_FileSystem)& theFileSystem = Handle(OSD_FileSystem)());
+
+  //! Returns maximum size of the loaded data in bytes, 0 means no limit.
+  Standard_Size Budget() const { return myBudget; }
+
+  //! Sets maximum size of the loaded data in bytes, 0 means no limit.
+  //! Unloads the least recently used triangulations if the new budget is exceeded.
+  Standard_EXPORT void SetBudget(const Standard_Size theBudget);
+
+  //! Makes the data of the triangulation available: loads it if necessary and marks it
+  //! as the most recently used one. Other triangulations are unloaded if the budget is exceeded,
+  //! but never the given one, even if its size alone exceeds the budget.
+  //! Returns FALSE if the triangulation has no deferred data or it cannot be loaded.
+  Standard_EXPORT Standard_Boolean Load(const Handle(MeshTriangulation)& theTriangulation);
+
+  //! Loads the data of the triangulation as Load() does and pins it: the triangulation
+  //! is not unloaded by the cache until the same number of Unpin() calls.
+  //! Returns FALSE if the triangulation cannot be loaded, it is not pinned in this case.
+  Standard_EXPORT Standard_Boolean Pin(const Handle(MeshTriangulation)& theTriangulation);
+
+  //! Releases the pin of the triangulation set by Pin().
+  //! The data is kept in memory and can be unloaded by the cache afterwards.
+  Standard_EXPORT void Unpin(const Handle(MeshTriangulation)& theTriangulation);
+
+  //! Unloads the data of the triangulation if it has been loaded through the cache.
+  //! Returns FALSE if the triangulation is not loaded or it is pinned.
+  Standard_EXPORT Standard_Boolean Unload(const Handle(MeshTriangulation)& theTriangulation);
+
+  //! Returns TRUE if the data of the triangulation has been loaded through the cache
+  //! and is still in memory.
+  Standard_EXPORT Standard_Boolean
+    IsLoaded(const Handle(MeshTriangulation)& theTriangulation) const;
+
+  //! Unloads all the triangulations loaded through the cache except the pinned ones.
+  Standard_EXPORT void Clear();
+
+public:
+  //! Pins the triangulation in the cache during the lifetime of the sentry.
+  class Sentry
+  {
+  public:
+    //! Loads and pins the triangulation.
+    Sentry(const Handle(Poly_TriangulationCache)& theCache,
+           const Handle(MeshTriangulation)&       theTriangulation)
+        : myCache(theCache),
+          myTriangulation(theTriangulation),
+          myIsLoaded(theCache->Pin(theTriangulation))
+    {
+    }
+
+    //! Unpins the triangulation.
+    ~Sentry()
+    {
+      if (myIsLoaded)
+      {
+        myCache->Unpin(myTriangulation);
+      }
+    }
+
+    //! Returns TRUE if the data of the triangulation is available.
+    Standard_Boolean IsLoaded() const { return myIsLoaded; }
+
+  private:
+    Sentry(const Sentry&)            = delete;
+    Sentry& operator=(const Sentry&) = delete;
+
+  private:
+    Handle(Poly_TriangulationCache) myCache;
+    Handle(MeshTriangulation)       myTriangulation;
+    Standard_Boolean                myIsLoaded;
+  };
+
+public: //! @name statistics
+  //! Returns number of triangulations in memory.
+  Standard_EXPORT Standard_Integer NbLoaded() const;
+
+  //! Returns size of the data in memory, in bytes.
+  Standard_EXPORT Standard_Size LoadedSize() const;
+
+  //! Returns number of Load() calls which have found the data in memory.
+  Standard_Size NbHits() const { return myNbHits.load(); }
+
+  //! Returns number of Load() calls which have loaded the data.
+  Standard_Size NbLoads() const { return myNbLoads.load(); }
+
+  //! Returns number of triangulations unloaded to keep the budget.
+  Standard_Size NbEvictions() const { return myNbEvictions.load(); }
+
+  //! Resets the counters of hits, loads and evictions.
+  Standard_EXPORT void ResetStatistics();
+
+  //! Returns size of the data of the triangulation in bytes
+  //! (nodes, triangles, UV nodes and normals).
+  Standard_EXPORT static Standard_Size DataSize(const Handle(MeshTriangulation)& theTriangulation);
+
+  DEFINE_STANDARD_RTTIEXT(Poly_TriangulationCache, RefObject)
+
+private:
+  //! Loaded triangulation, item of the queue of triangulations ordered by the time of access.
+  struct Entry
+  {
+    Handle(MeshTriangulation) Triangulation;
+    Standard_Size             Size;
+    Standard_Integer          NbPins;   //!< number of Pin() calls not followed by Unpin()
+    Entry*                    Previous; //!< less recently used triangulation
+    Entry*                    Next;     //!< more recently used triangulation
+  };
+
+  //! Loads the triangulation and marks it as the most recently used one, pins it if requested.
+  //! The data is read out of the lock and published in the triangulation under the lock.
+  Standard_Boolean load(const Handle(MeshTriangulation)& theTriangulation,
+                        const Standard_Boolean           theToPin);
+
+  //! Marks the loaded triangulation as the most recently used one and pins it if requested.
+  //! Returns FALSE if the triangulation is not loaded through the cache,
+  //! the number of pins of its entry without data is added to theNbPins in this case.
+  Standard_Boolean touch(const Handle(MeshTriangulation)& theTriangulation,
+                         Standard_Integer&                theNbPins);
+
+  //! Appends the entry to the end of the queue.
+  void link(Entry* theEntry);
+
+  //! Removes the entry from the queue.
+  void unlink(Entry* theEntry);
+
+  //! Unloads the least recently used triangulations until the budget is kept,
+  //! the most recently used one and the pinned ones are never unloaded.
+  void evict();
+
+  //! Unloads the triangulation and forgets it.
+  void unload(Entry* theEntry);
+
+private:
+  Handle(OSD_FileSystem)                                myFileSystem;
+  NCollection_DataMap<Handle(MeshTriangulation), Entry> myEntries; //!< loaded triangulations
+  Entry*                     myFirst; //!< the least recently used triangulation
+  Entry*                     myLast;  //!< the most recently used triangulation
+  mutable Standard_Mutex     myMutex;
+  Standard_Size              myBudget;
+  Standard_Size              myLoadedSize;
+  std::atomic<Standard_Size> myNbHits;
+  std::atomic<Standard_Size> myNbLoads;
+  std::atomic<Standard_Size> myNbEvictions;
+};
+
+#endif // _Poly_TriangulationCache_HeaderFile
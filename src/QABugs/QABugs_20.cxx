@@ -5264,6 +5264,502 @@ static Standard_Integer OCC26441(DrawInterpreter& theDi,
   return 0;
 }
 
+#include <BSplSLib_Cache.hxx>
+#include <TColgp_Array1OfVec.hxx>
+
+#include <limits>
+
+namespace
+{
+//! Fills the sorted sample parameters of the range; the range of periodic
+//! geometry is extended by a half of period to cross the seam
+static void fillSampleParameters(const Standard_Real    theFirst,
+                                 const Standard_Real    theLast,
+                                 const Standard_Boolean theIsPeriodic,
+                                 const Standard_Real    thePeriod,
+                                 TColStd_Array1OfReal&  theParams)
+{
+  const Standard_Real aLast = theIsPeriodic ? theFirst + 1.5 * thePeriod : theLast;
+  const Standard_Real aStep = (aLast - theFirst) / (theParams.Length() - 1);
+  for (Standard_Integer anIndex = theParams.Lower(); anIndex < theParams.Upper(); ++anIndex)
+  {
+    theParams(anIndex) = theFirst + (anIndex - theParams.Lower()) * aStep;
+  }
+  theParams(theParams.Upper()) = aLast;
+}
+
+//! Replaces some of the sample parameters by NaN and parameters out of the range
+static void addInvalidParameters(const Standard_Real   theFirst,
+                                 const Standard_Real   theLast,
+                                 TColStd_Array1OfReal& theParams)
+{
+  const Standard_Integer aMiddle = (theParams.Lower() + theParams.Upper()) / 2;
+  theParams(theParams.Lower() + 1) = std::numeric_limits<Standard_Real>::quiet_NaN();
+  theParams(aMiddle)               = theFirst - (theLast - theFirst);
+  theParams(theParams.Upper() - 1) = theLast + (theLast - theFirst);
+}
+
+//! Returns true if the parameter is NaN, the evaluation result is undefined then
+static Standard_Boolean isNaN(const Standard_Real theParam)
+{
+  return theParam != theParam;
+}
+
+//! Returns true if the points are exactly the same
+static Standard_Boolean isSamePoint(const Point3d& thePnt1, const Point3d& thePnt2)
+{
+  return thePnt1.X() == thePnt2.X() && thePnt1.Y() == thePnt2.Y() && thePnt1.Z() == thePnt2.Z();
+}
+
+//! Returns true if the vectors are exactly the same
+static Standard_Boolean isSameVector(const Vector3d& theVec1, const Vector3d& theVec2)
+{
+  return theVec1.X() == theVec2.X() && theVec1.Y() == theVec2.Y() && theVec1.Z() == theVec2.Z();
+}
+} // namespace
+
+//=================================================================================================
+
+static Standard_Integer QABatchEvaluation(DrawInterpreter& theDI,
+                                          Standard_Integer  theNbArgs,
+                                          const char**      theArgVec)
+{
+  const Standard_Boolean isInvalid = theNbArgs == 4 && strcmp(theArgVec[3], "-invalid") == 0;
+  if (theNbArgs != 3 && !isInvalid)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  Standard_CString       aName      = theArgVec[1];
+  const Standard_Integer aNbSamples = Draw1::Atoi(theArgVec[2]);
+  if (aNbSamples < (isInvalid ? 6 : 2))
+  {
+    theDI << "Syntax error: too few samples\n";
+    return 1;
+  }
+
+  Standard_Integer    aNbErrors = 0;
+  Handle(GeomCurve3d) aCurve    = DrawTrSurf1::GetCurve(aName);
+  Handle(GeomSurface) aSurface;
+  if (aCurve.IsNull())
+  {
+    aSurface = DrawTrSurf1::GetSurface(aName);
+    if (aSurface.IsNull())
+    {
+      theDI << "Error: " << theArgVec[1] << " is neither a curve nor a surface\n";
+      return 1;
+    }
+  }
+
+  if (!aCurve.IsNull())
+  {
+    // the adaptors are created separately to start with the same state of their caches
+    GeomAdaptor_Curve    aPointAdaptor(aCurve), aBatchAdaptor(aCurve);
+    TColStd_Array1OfReal aParams(1, aNbSamples);
+    fillSampleParameters(aPointAdaptor.FirstParameter(),
+                         aPointAdaptor.LastParameter(),
+                         aPointAdaptor.IsPeriodic(),
+                         aPointAdaptor.IsPeriodic() ? aPointAdaptor.Period() : 0.0,
+                         aParams);
+    if (isInvalid)
+    {
+      addInvalidParameters(aPointAdaptor.FirstParameter(), aPointAdaptor.LastParameter(), aParams);
+    }
+
+    TColgp_Array1OfPnt aPoints(1, aNbSamples);
+    aBatchAdaptor.D0(aParams, aPoints);
+    for (Standard_Integer anIndex = 1; anIndex <= aNbSamples; ++anIndex)
+    {
+      Point3d aPnt;
+      aPointAdaptor.D0(aParams(anIndex), aPnt);
+      if (!isNaN(aParams(anIndex)) && !isSamePoint(aPnt, aPoints(anIndex)))
+      {
+        theDI << "Error: different D0 at parameter " << aParams(anIndex) << "\n";
+        ++aNbErrors;
+      }
+    }
+  }
+  else
+  {
+    GeomAdaptor_Surface    aPointAdaptor(aSurface), aBatchAdaptor(aSurface);
+    const Standard_Integer aNbPoints = aNbSamples * aNbSamples;
+    TColStd_Array1OfReal   aUParams(1, aNbSamples), aVParams(1, aNbSamples);
+    fillSampleParameters(aPointAdaptor.FirstUParameter(),
+                         aPointAdaptor.LastUParameter(),
+                         aPointAdaptor.IsUPeriodic(),
+                         aPointAdaptor.IsUPeriodic() ? aPointAdaptor.UPeriod() : 0.0,
+                         aUParams);
+    fillSampleParameters(aPointAdaptor.FirstVParameter(),
+                         aPointAdaptor.LastVParameter(),
+                         aPointAdaptor.IsVPeriodic(),
+                         aPointAdaptor.IsVPeriodic() ? aPointAdaptor.VPeriod() : 0.0,
+                         aVParams);
+    if (isInvalid)
+    {
+      addInvalidParameters(aPointAdaptor.FirstUParameter(),
+                           aPointAdaptor.LastUParameter(),
+                           aUParams);
+      addInvalidParameters(aPointAdaptor.FirstVParameter(),
+                           aPointAdaptor.LastVParameter(),
+                           aVParams);
+    }
+
+    // grid of parameters, V varies first
+    TColStd_Array1OfReal aU(1, aNbPoints), aV(1, aNbPoints);
+    for (Standard_Integer anIndex = 1; anIndex <= aNbPoints; ++anIndex)
+    {
+      aU(anIndex) = aUParams((anIndex - 1) / aNbSamples + 1);
+      aV(anIndex) = aVParams((anIndex - 1) % aNbSamples + 1);
+    }
+
+    TColgp_Array1OfPnt aPoints0(1, aNbPoints), aPoints1(1, aNbPoints);
+    TColgp_Array1OfVec aD1U(1, aNbPoints), aD1V(1, aNbPoints);
+    aBatchAdaptor.D0(aU, aV, aPoints0);
+    aBatchAdaptor.D1(aU, aV, aPoints1, aD1U, aD1V);
+    for (Standard_Integer anIndex = 1; anIndex <= aNbPoints; ++anIndex)
+    {
+      Point3d  aPnt0, aPnt1;
+      Vector3d aVecU, aVecV;
+      aPointAdaptor.D0(aU(anIndex), aV(anIndex), aPnt0);
+      aPointAdaptor.D1(aU(anIndex), aV(anIndex), aPnt1, aVecU, aVecV);
+      if (isNaN(aU(anIndex)) || isNaN(aV(anIndex)))
+      {
+        continue;
+      }
+      if (!isSamePoint(aPnt0, aPoints0(anIndex)))
+      {
+        theDI << "Error: different D0 at parameters " << aU(anIndex) << " " << aV(anIndex)
+              << "\n";
+        ++aNbErrors;
+      }
+      if (!isSamePoint(aPnt1, aPoints1(anIndex)) || !isSameVector(aVecU, aD1U(anIndex))
+          || !isSameVector(aVecV, aD1V(anIndex)))
+      {
+        theDI << "Error: different D1 at parameters " << aU(anIndex) << " " << aV(anIndex)
+              << "\n";
+        ++aNbErrors;
+      }
+    }
+
+    // caches of B-spline spans evaluated directly
+    Handle(Geom_BSplineSurface) aBSpline = Handle(Geom_BSplineSurface)::DownCast(aSurface);
+    if (!aBSpline.IsNull() && !isInvalid)
+    {
+      Standard_Integer anIndex = 1;
+      while (anIndex <= aNbPoints)
+      {
+        const Handle(BSplSLib_Cache) aCache = aBSpline->SpanCache(aU(anIndex), aV(anIndex));
+        const Standard_Integer       aNext  = aCache->D0(aU, aV, anIndex, aPoints0);
+        aCache->D1(aU, aV, anIndex, aPoints1, aD1U, aD1V);
+        if (aNext == anIndex)
+        {
+          theDI << "Error: the span cache is not valid at its parameters\n";
+          ++aNbErrors;
+          break;
+        }
+        for (; anIndex < aNext; ++anIndex)
+        {
+          Point3d  aPnt0, aPnt1;
+          Vector3d aVecU, aVecV;
+          aCache->D0(aU(anIndex), aV(anIndex), aPnt0);
+          aCache->D1(aU(anIndex), aV(anIndex), aPnt1, aVecU, aVecV);
+          if (!isSamePoint(aPnt0, aPoints0(anIndex)) || !isSamePoint(aPnt1, aPoints1(anIndex))
+              || !isSameVector(aVecU, aD1U(anIndex)) || !isSameVector(aVecV, aD1V(anIndex)))
+          {
+            theDI << "Error: different values of the span cache at parameters " << aU(anIndex)
+                  << " " << aV(anIndex) << "\n";
+            ++aNbErrors;
+          }
+        }
+      }
+    }
+  }
+
+  if (aNbErrors == 0)
+  {
+    theDI << "Batch evaluation is the same as evaluation by points\n";
+  }
+  return 0;
+}
+
+//=================================================================================================
+
+static Standard_Integer QASpanCacheTable(DrawInterpreter& theDI,
+                                         Standard_Integer  theNbArgs,
+                                         const char**      theArgVec)
+{
+  if (theNbArgs != 4)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  Standard_CString            aName      = theArgVec[1];
+  const Standard_Integer      aMaxNb     = Draw1::Atoi(theArgVec[2]);
+  const Standard_Integer      aNbSamples = Draw1::Atoi(theArgVec[3]);
+  Handle(Geom_BSplineSurface) aSurface =
+    Handle(Geom_BSplineSurface)::DownCast(DrawTrSurf1::GetSurface(aName));
+  if (aSurface.IsNull() || aMaxNb < 1 || aNbSamples < 2)
+  {
+    theDI << "Syntax error: B-spline surface, number of caches and samples are expected\n";
+    return 1;
+  }
+
+  const Handle(BSplSLib_CacheTable)& aTable = aSurface->SpanCacheTable();
+
+  TColStd_Array1OfReal aUParams(1, aNbSamples), aVParams(1, aNbSamples);
+  fillSampleParameters(aSurface->UKnot(1),
+                       aSurface->UKnot(aSurface->NbUKnots()),
+                       Standard_False,
+                       0.0,
+                       aUParams);
+  fillSampleParameters(aSurface->VKnot(1),
+                       aSurface->VKnot(aSurface->NbVKnots()),
+                       Standard_False,
+                       0.0,
+                       aVParams);
+
+  // dense sweep keeping all the caches, then with the limited number of caches
+  const Standard_Integer aNbPoints = aNbSamples * aNbSamples;
+  TColgp_Array1OfPnt     aPoints(1, aNbPoints);
+  Standard_Integer       aNbErrors = 0;
+  aTable->SetMaxNbCaches(IntegerLast());
+  for (Standard_Integer aPass = 0; aPass < 2; ++aPass)
+  {
+    GeomAdaptor_Surface anAdaptor(aSurface);
+    for (Standard_Integer anIndex = 1; anIndex <= aNbPoints; ++anIndex)
+    {
+      Point3d aPnt;
+      anAdaptor.D0(aUParams((anIndex - 1) / aNbSamples + 1),
+                   aVParams((anIndex - 1) % aNbSamples + 1),
+                   aPnt);
+      if (aPass == 0)
+      {
+        aPoints(anIndex) = aPnt;
+      }
+      else if (!isSamePoint(aPnt, aPoints(anIndex)))
+      {
+        ++aNbErrors;
+      }
+    }
+    theDI << "Number of span caches: " << aTable->NbCaches() << "\n";
+    if (aPass == 0)
+    {
+      aTable->SetMaxNbCaches(aMaxNb);
+      if (aTable->NbCaches() > aMaxNb)
+      {
+        theDI << "Error: the number of span caches exceeds the limit after its change\n";
+      }
+    }
+    else if (aTable->NbCaches() > aMaxNb)
+    {
+      theDI << "Error: the number of span caches exceeds the limit\n";
+    }
+  }
+  if (aNbErrors != 0)
+  {
+    theDI << "Error: " << aNbErrors << " points differ after release of span caches\n";
+  }
+  return 0;
+}
+
+#include <NCollection_Vector.hxx>
+#include <Precision.hxx>
+#include <TopoDS_Iterator.hxx>
+
+//=================================================================================================
+
+static Standard_Integer QATShapeChildren(DrawInterpreter& theDI,
+                                         Standard_Integer  theNbArgs,
+                                         const char**      theArgVec)
+{
+  if (theNbArgs != 2)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+  const Standard_Integer aNbChildren = Draw1::Atoi(theArgVec[1]);
+
+  ShapeBuilder                   aBuilder;
+  NCollection_Vector<TopoVertex> aVertices;
+  for (Standard_Integer anIndex = 0; anIndex < aNbChildren; ++anIndex)
+  {
+    TopoVertex aVertex;
+    aBuilder.MakeVertex(aVertex, Point3d(anIndex, 0.0, 0.0), Precision1::Confusion());
+    aVertices.Append(aVertex);
+  }
+
+  // the storage of children is released with the last one and allocated again
+  TopoCompound aCompound;
+  aBuilder.MakeCompound(aCompound);
+  for (Standard_Integer aPass = 0; aPass < 3; ++aPass)
+  {
+    for (Standard_Integer anIndex = 0; anIndex < aNbChildren; ++anIndex)
+    {
+      aBuilder.Add(aCompound, aVertices(anIndex));
+    }
+    if (aCompound.NbChildren() != aNbChildren)
+    {
+      theDI << "Error: wrong number of children after adding\n";
+    }
+    // remove from the middle, the end and the beginning alternately
+    for (Standard_Integer anIndex = 0; anIndex < aNbChildren; ++anIndex)
+    {
+      const Standard_Integer aRank = (anIndex % 3 == 0) ? aCompound.NbChildren() / 2
+                                     : (anIndex % 3 == 1) ? aCompound.NbChildren() - 1
+                                                          : 0;
+      TopoDS_Iterator anIt(aCompound);
+      for (Standard_Integer aSkip = 0; aSkip < aRank; ++aSkip)
+      {
+        anIt.Next();
+      }
+      const TopoShape aChild = anIt.Value();
+      aBuilder.Remove(aCompound, aChild);
+    }
+    if (aCompound.NbChildren() != 0)
+    {
+      theDI << "Error: wrong number of children after removal\n";
+    }
+  }
+
+  // the compound is destroyed without children, then with the children added again
+  {
+    TopoCompound anEmpty;
+    aBuilder.MakeCompound(anEmpty);
+    aBuilder.Add(anEmpty, aVertices(0));
+    aBuilder.Remove(anEmpty, aVertices(0));
+  }
+  aBuilder.Add(aCompound, aVertices(0));
+  theDI << "Number of children: " << aCompound.NbChildren() << "\n";
+  return 0;
+}
+
+#include <Interface_FloatWriter.hxx>
+
+#include <cfloat>
+#include <random>
+
+namespace
+{
+//! Compares the text written by InterfaceFloatWriter::Convert() with the output of sprintf
+//! for the format "%<width>.<precision><type>", reports the first differences.
+static void checkFloatWriter(DrawInterpreter&       theDI,
+                             const Standard_Real    theValue,
+                             const Standard_Integer theWidth,
+                             const Standard_Integer thePrecision,
+                             const char             theType,
+                             Standard_Integer&      theNbValues,
+                             Standard_Integer&      theNbDiffs)
+{
+  char aFormat[16], aText[512], aSample[512];
+  Sprintf(aFormat, "%%%d.%d%c", theWidth, thePrecision, theType);
+  InterfaceFloatWriter::Convert(theValue, aText, Standard_False, 0.0, 0.0, aFormat, aFormat);
+  Sprintf(aSample, aFormat, theValue);
+  ++theNbValues;
+  if (strcmp(aText, aSample) != 0 && ++theNbDiffs <= 10)
+  {
+    char aValue[32];
+    Sprintf(aValue, "%.17g", theValue);
+    theDI << "Error: " << aValue << " with format " << aFormat << " is written as '" << aText
+          << "' instead of '" << aSample << "'\n";
+  }
+}
+} // namespace
+
+//=================================================================================================
+
+static Standard_Integer QAFloatWriter(DrawInterpreter& theDI,
+                                      Standard_Integer theNbArgs,
+                                      const char**     theArgVec)
+{
+  if (theNbArgs != 2)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  const Standard_Integer aNbRandom = Draw1::Atoi(theArgVec[1]);
+  Standard_Integer       aNbValues = 0;
+  Standard_Integer       aNbDiffs  = 0;
+  const Standard_Integer aPrecMax  = 17; // maximal precision written without sprintf
+  const Standard_Real    aSigns[2] = {1.0, -1.0};
+  const Standard_Real    aZeros[2] = {0.0, -0.0};
+
+  for (Standard_Integer aPrec = 1; aPrec <= aPrecMax; ++aPrec)
+  {
+    for (Standard_Integer aSignIter = 0; aSignIter < 2; ++aSignIter)
+    {
+      const Standard_Real aSign = aSigns[aSignIter];
+
+      // zeros, also written without sprintf with the exponent format
+      checkFloatWriter(theDI, aZeros[aSignIter], 14, aPrec, 'f', aNbValues, aNbDiffs);
+      checkFloatWriter(theDI, aZeros[aSignIter], 14, aPrec, 'E', aNbValues, aNbDiffs);
+
+      // subnormal and minimal normalized values
+      const Standard_Real aTiny[4] = {DBL_MIN,
+                                      DBL_MIN / 2.0,
+                                      DBL_MIN / 1024.0,
+                                      DBL_MIN * DBL_EPSILON};
+      for (Standard_Integer anIter = 0; anIter < 4; ++anIter)
+      {
+        checkFloatWriter(theDI, aSign * aTiny[anIter], 0, aPrec, 'f', aNbValues, aNbDiffs);
+      }
+
+      // exact halves of the last written digit: odd numbers divided by 2^(precision + 1)
+      for (Standard_Integer anOdd = 1; anOdd < 64; anOdd += 2)
+      {
+        const Standard_Real aTie = std::ldexp(Standard_Real(anOdd), -(aPrec + 1));
+        checkFloatWriter(theDI, aSign * aTie, 0, aPrec, 'f', aNbValues, aNbDiffs);
+        checkFloatWriter(theDI, aSign * (aTie + 1000.0), 0, aPrec, 'f', aNbValues, aNbDiffs);
+      }
+
+      // powers of ten and their neighbors
+      for (Standard_Integer aPower = -20; aPower <= 20; ++aPower)
+      {
+        char aText[16];
+        Sprintf(aText, "1e%d", aPower);
+        const Standard_Real aValue = aSign * Atof(aText);
+        checkFloatWriter(theDI, aValue, 14, aPrec, 'f', aNbValues, aNbDiffs);
+        checkFloatWriter(theDI, std::nextafter(aValue, 0.0), 14, aPrec, 'f', aNbValues, aNbDiffs);
+        checkFloatWriter(theDI,
+                         std::nextafter(aValue, aSign * DBL_MAX),
+                         14,
+                         aPrec,
+                         'f',
+                         aNbValues,
+                         aNbDiffs);
+      }
+    }
+  }
+
+  // random finite values of any magnitude with random formats
+  std::mt19937_64 aGenerator(1);
+  for (Standard_Integer anIter = 0; anIter < aNbRandom; ++anIter)
+  {
+    const uint64_t aBits = aGenerator();
+    Standard_Real  aValue;
+    memcpy(&aValue, &aBits, sizeof(aValue));
+    if (!std::isfinite(aValue))
+    {
+      continue;
+    }
+    // random bits mostly give huge or tiny values, so that their exponent is reduced
+    if (anIter % 2 == 0)
+    {
+      int anExp = 0;
+      aValue    = std::ldexp(std::frexp(aValue, &anExp), anExp % 64);
+    }
+    const Standard_Integer aWidth = Standard_Integer(aGenerator() % 25);
+    const Standard_Integer aPrec  = 1 + Standard_Integer(aGenerator() % aPrecMax);
+    checkFloatWriter(theDI, aValue, aWidth, aPrec, 'f', aNbValues, aNbDiffs);
+  }
+
+  theDI << "Number of values: " << aNbValues << "\n";
+  theDI << "Number of differences: " << aNbDiffs << "\n";
+  return 0;
+}
+
 void QABugs1::Commands_20(DrawInterpreter& theCommands)
 {
   const char* group = "QABugs1";
@@ -5460,5 +5956,37 @@ void QABugs1::Commands_20(DrawInterpreter& theCommands)
                   OCC33657_4,
                   group);
 
+  theCommands.Add("QABatchEvaluation",
+                  "QABatchEvaluation curve|surface nbsamples [-invalid]"
+                  "\n\t\t: Compares evaluation of B-spline geometry on arrays of parameters"
+                  "\n\t\t: with evaluation point by point."
+                  "\n\t\t: -invalid adds NaN and parameters out of the range to the samples.",
+                  __FILE__,
+                  QABatchEvaluation,
+                  group);
+
+  theCommands.Add("QASpanCacheTable",
+                  "QASpanCacheTable surface maxnbcaches nbsamples"
+                  "\n\t\t: Sweeps B-spline surface with the limited number of span caches"
+                  "\n\t\t: and prints the number of kept caches.",
+                  __FILE__,
+                  QASpanCacheTable,
+                  group);
+
+  theCommands.Add("QATShapeChildren",
+                  "QATShapeChildren nbchildren"
+                  "\n\t\t: Adds children to a compound and removes all of them several times.",
+                  __FILE__,
+                  QATShapeChildren,
+                  group);
+
+  theCommands.Add("QAFloatWriter",
+                  "QAFloatWriter nbrandom"
+                  "\n\t\t: Compares reals written by InterfaceFloatWriter with the output of sprintf"
+                  "\n\t\t: for subnormal values, ties, powers of ten and random values.",
+                  __FILE__,
+                  QAFloatWriter,
+                  group);
+
   return;
 }
@@ -14,10 +14,20 @@
 // commercial license or contractual agreement.
 
 #include <QADNaming.hxx>
+#include <BRepAlgoAPI_BuilderAlgo.hxx>
+#include <BRepAlgoAPI_Cut.hxx>
+#include <BRepTools_History.hxx>
 #include <TDF_Label.hxx>
 #include <Draw_Interpretor.hxx>
 #include <TNaming_Builder.hxx>
+#include <TNaming_Iterator.hxx>
+#include <TNaming_NamedShape.hxx>
+#include <TNaming_NewShapeIterator.hxx>
+#include <TopAbs.hxx>
+#include <TopExp.hxx>
 #include <TopoDS_Shape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopTools_ListOfShape.hxx>
 #include <DBRep.hxx>
 
 static Standard_Integer BuildNamedShape(DrawInterpreter& di, Standard_Integer nb, const char** arg)
@@ -87,6 +97,178 @@ static Standard_Integer BuildNamedShape(DrawInterpreter& di, Standard_Integer nb
   return 0;
 }
 
+//=================================================================================================
+
+static Standard_Integer BuildNamedShapeFromHistory(DrawInterpreter& di,
+                                                   Standard_Integer  nb,
+                                                   const char**      arg)
+{
+  if (nb < 6)
+  {
+    di.PrintHelp(arg[0]);
+    return 1;
+  }
+  DataLabel aLabel;
+  if (!QADNaming1::Entry(arg, aLabel))
+    return 1;
+  const char       anEvolution = arg[3][0];
+  TopAbs_ShapeEnum aType       = TopAbs_SHAPE;
+  if (!TopAbs1::ShapeTypeFromString(arg[4], aType))
+  {
+    di << "Unknown shape type " << arg[4] << "\n";
+    return 1;
+  }
+
+  ShapeList        anArguments;
+  Standard_Boolean isCut = Standard_False;
+  DataLabel        aRefLabel;
+  for (Standard_Integer a = 5; a < nb; ++a)
+  {
+    if (strcmp(arg[a], "-cut") == 0)
+    {
+      isCut = Standard_True;
+      continue;
+    }
+    if (strcmp(arg[a], "-compare") == 0 && a + 1 < nb)
+    {
+      const char* aRefArgs[3] = {arg[0], arg[1], arg[++a]};
+      if (!QADNaming1::Entry(aRefArgs, aRefLabel))
+        return 1;
+      continue;
+    }
+    const TopoShape aShape = DBRep1::Get(arg[a]);
+    if (aShape.IsNull())
+    {
+      di << arg[a] << " is a null shape\n";
+      return 1;
+    }
+    anArguments.Append(aShape);
+  }
+  if (anArguments.IsEmpty())
+  {
+    di.PrintHelp(arg[0]);
+    return 1;
+  }
+
+  // split the shapes by each other or cut the first one by the others
+  // to get the history of their sub-shapes
+  BRepAlgoAPI_BuilderAlgo aSplitter;
+  BooleanCut              aCut;
+  BRepAlgoAPI_BuilderAlgo& anAlgo = isCut ? aCut : aSplitter;
+  if (isCut)
+  {
+    ShapeList anObjects, aTools;
+    anObjects.Append(anArguments.First());
+    aTools.Assign(anArguments);
+    aTools.RemoveFirst();
+    aCut.SetArguments(anObjects);
+    aCut.SetTools(aTools);
+  }
+  else
+  {
+    aSplitter.SetArguments(anArguments);
+  }
+  anAlgo.Build();
+  if (!anAlgo.IsDone())
+  {
+    di << "Splitting of the shapes has failed\n";
+    return 1;
+  }
+  const Handle(ShapeHistory) aHistory = anAlgo.History();
+
+  TNaming_Builder aBuilder(aLabel);
+  for (TopTools_ListIteratorOfListOfShape anIter(anArguments); anIter.More(); anIter.Next())
+  {
+    switch (anEvolution)
+    {
+      case 'G':
+        aBuilder.Generated(aHistory, anIter.Value(), aType);
+        break;
+      case 'M':
+        aBuilder.Modify(aHistory, anIter.Value(), aType);
+        break;
+      case 'D':
+        aBuilder.Delete(aHistory, anIter.Value(), aType);
+        break;
+      default:
+        di << "Unknown evolution type\n";
+        return 1;
+    }
+  }
+  if (aRefLabel.IsNull())
+    return 0;
+
+  // record the same history pair by pair into the reference named shape
+  TNaming_Builder aRefBuilder(aRefLabel);
+  for (TopTools_ListIteratorOfListOfShape anIter(anArguments); anIter.More(); anIter.Next())
+  {
+    TopTools_IndexedMapOfShape aSubShapes;
+    TopExp1::MapShapes(anIter.Value(), aType, aSubShapes);
+    for (Standard_Integer anIndex = 1; anIndex <= aSubShapes.Extent(); ++anIndex)
+    {
+      const TopoShape& anOldShape = aSubShapes(anIndex);
+      if (anEvolution == 'D')
+      {
+        if (aHistory->IsRemoved(anOldShape))
+          aRefBuilder.Delete(anOldShape);
+        continue;
+      }
+      const ShapeList& aNewList = anEvolution == 'M' ? aHistory->Modified(anOldShape)
+                                                     : aHistory->Generated(anOldShape);
+      for (TopTools_ListIteratorOfListOfShape aNewIter(aNewList); aNewIter.More(); aNewIter.Next())
+      {
+        if (anOldShape.IsSame(aNewIter.Value()))
+          continue;
+        if (anEvolution == 'M')
+          aRefBuilder.Modify(anOldShape, aNewIter.Value());
+        else
+          aRefBuilder.Generated(anOldShape, aNewIter.Value());
+      }
+    }
+  }
+
+  // both named shapes should have the same pairs in the same order
+  // and the same uses of old shapes
+  const Handle(ShapeAttribute) aNamedShape    = aBuilder.NamedShape1();
+  const Handle(ShapeAttribute) aRefNamedShape = aRefBuilder.NamedShape1();
+  Iterator1                    anIter(aNamedShape), aRefIter(aRefNamedShape);
+  Standard_Integer             aNbPairs = 0;
+  for (; anIter.More() && aRefIter.More(); anIter.Next(), aRefIter.Next(), ++aNbPairs)
+  {
+    if (anIter.Evolution() != aRefIter.Evolution()
+        || !anIter.OldShape().IsEqual(aRefIter.OldShape())
+        || !anIter.NewShape().IsEqual(aRefIter.NewShape()))
+    {
+      di << "Error: pair " << aNbPairs + 1 << " differs from the one recorded separately\n";
+      return 1;
+    }
+
+    Standard_Integer aNbUses = 0, aNbRefUses = 0;
+    for (NewShapeIterator aUseIter(anIter.OldShape(), aLabel); aUseIter.More(); aUseIter.Next())
+    {
+      if (aUseIter.NamedShape1() == aNamedShape)
+        ++aNbUses;
+      else if (aUseIter.NamedShape1() == aRefNamedShape)
+        ++aNbRefUses;
+    }
+    if (aNbUses != aNbRefUses)
+    {
+      di << "Error: uses of old shape of pair " << aNbPairs + 1
+         << " differ from the ones recorded separately\n";
+      return 1;
+    }
+  }
+  if (anIter.More() || aRefIter.More())
+  {
+    di << "Error: number of pairs differs from the one recorded separately\n";
+    return 1;
+  }
+  di << aNbPairs;
+  return 0;
+}
+
+//=================================================================================================
+
 void QADNaming1::BuilderCommands(DrawInterpreter& theCommands)
 {
   static Standard_Boolean done = Standard_False;
@@ -102,4 +284,16 @@ void QADNaming1::BuilderCommands(DrawInterpreter& theCommands)
                   __FILE__,
                   BuildNamedShape,
                   g);
+
+  theCommands.Add("BuildNamedShapeFromHistory",
+                  "BuildNamedShapeFromHistory df entry evolution(G[ENERATED] M[ODIFY] D[ELETE]) "
+                  "type shape1 [shape2 ...] [-cut] [-compare entry2]"
+                  "\n\t\t: Splits the shapes by each other and records at once the history of "
+                  "their sub-shapes of the given type."
+                  "\n\t\t: -cut     cut the first shape by the others instead of splitting."
+                  "\n\t\t: -compare record the same history pair by pair at entry2, check that"
+                  "\n\t\t:          both named shapes have the same pairs and return their number.",
+                  __FILE__,
+                  BuildNamedShapeFromHistory,
+                  g);
 }
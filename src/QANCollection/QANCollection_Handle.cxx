@@ -638,6 +638,63 @@ static Standard_Integer QAHandleKind(DrawInterpreter& /*theDI*/,
   return 0;
 }
 
+//=======================================================================
+// function : QAHandleKindPerf
+// purpose  : Estimate the time of type checks in a deep hierarchy
+//=======================================================================
+static Standard_Integer QAHandleKindPerf(DrawInterpreter& theDI,
+                                         Standard_Integer  theArgNb,
+                                         const char**      theArgVec)
+{
+  if (theArgNb > 2)
+  {
+    std::cout << "Error: wrong syntax! See usage:\n";
+    theDI.PrintHelp(theArgVec[0]);
+    return 1;
+  }
+  const Standard_Integer aNbIters = (theArgNb > 1) ? Draw1::Atoi(theArgVec[1]) : 10000000;
+  if (aNbIters < 1)
+  {
+    std::cout << "Error: number of iterations should be positive!\n";
+    return 1;
+  }
+
+  Handle(RefObject) aHandle  = new qaclass50_50();
+  Handle(TypeInfo)  aTypes[] = {STANDARD_TYPE(qaclass00_50),
+                                STANDARD_TYPE(qaclass40_50),
+                                STANDARD_TYPE(qaclass49_50),
+                                STANDARD_TYPE(NCollection_BaseAllocator)};
+  Standard_Integer  aNbKinds = 0, aNbCasts = 0;
+  theDI << "Time of type checks of an instance of a class of depth 51, per item, ns:";
+  {
+    QATimer aTimer(theDI, "\nIsKind:   ", QATimer::ns, aNbIters);
+    for (Standard_Integer anIter = 0; anIter < aNbIters; ++anIter)
+    {
+      if (aHandle->IsKind(aTypes[anIter % 4]))
+      {
+        ++aNbKinds;
+      }
+    }
+  }
+  {
+    QATimer aTimer(theDI, "\nDownCast: ", QATimer::ns, aNbIters);
+    for (Standard_Integer anIter = 0; anIter < aNbIters; ++anIter)
+    {
+      if (!Handle(qaclass00_50)::DownCast(aHandle).IsNull())
+      {
+        ++aNbCasts;
+      }
+    }
+  }
+  theDI << "\n";
+  // the instance is not kind of the last type only
+  CHECK(theDI, aNbKinds == aNbIters - aNbIters / 4, "IsKind results");
+  CHECK(theDI, aNbCasts == aNbIters, "DownCast results");
+  return 0;
+}
+
+//=================================================================================================
+
 void QANCollection1::CommandsHandle(DrawInterpreter& theCommands)
 {
   const char* THE_GROUP = "QANCollection1";
@@ -653,6 +710,12 @@ void QANCollection1::CommandsHandle(DrawInterpreter& theCommands)
                   QAHandleInc,
                   THE_GROUP);
   theCommands.Add("QAHandleKind", "Test handle IsKind", __FILE__, QAHandleKind, THE_GROUP);
+  theCommands.Add("QAHandleKindPerf",
+                  "QAHandleKindPerf nbIter=10000000"
+                  "\n\t\t: Test performance of type checks in a deep hierarchy",
+                  __FILE__,
+                  QAHandleKindPerf,
+                  THE_GROUP);
   theCommands.Add("QAHandleOps", "Test handle operations", __FILE__, QAHandleOps, THE_GROUP);
   return;
 }
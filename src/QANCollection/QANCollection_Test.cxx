@@ -57,6 +57,8 @@ DEFINE_HARRAY2(QANCollection_HArray2Func, QANCollection_Array2Func)
 #include <NCollection_DoubleMap.hxx>
 #include <NCollection_IndexedMap.hxx>
 #include <NCollection_IndexedDataMap.hxx>
+#include <NCollection_FlatIndexedMap.hxx>
+#include <NCollection_FlatMap.hxx>
 #define DEFINE_DATAMAP(_ClassName_, _BaseCollection_, TheKeyType, TheItemType)                     \
   typedef NCollection_DataMap<TheKeyType, TheItemType> _ClassName_;
 #define DEFINE_DOUBLEMAP(_ClassName_, _BaseCollection_, TheKey1Type, TheKey2Type)                  \
@@ -897,6 +899,158 @@ static Standard_Integer QANColTestIndexedDataMap(DrawInterpreter& di,
 
 //=================================================================================================
 
+static Standard_Integer QANColTestFlatMap(DrawInterpreter&, Standard_Integer, const char**)
+{
+  // the flat maps should give the same indices and contents as the node-based ones
+  NCollection_IndexedMap<Standard_Integer>     anIMap;
+  NCollection_FlatIndexedMap<Standard_Integer> aFlatIMap;
+  NCollection_Map<Standard_Integer>            aMap;
+  NCollection_FlatMap<Standard_Integer>        aFlatMap;
+  Standard_Boolean                             isOK = Standard_True;
+
+  unsigned int aSeed = 12345;
+  for (Standard_Integer anIter = 0; anIter < 200000 && isOK; ++anIter)
+  {
+    aSeed                        = aSeed * 1103515245u + 12345u;
+    const Standard_Integer aKey  = (Standard_Integer)((aSeed >> 8) % 5000u) * 64;
+    const unsigned int     anOp  = (aSeed >> 24) % 4u;
+    Standard_Integer       anInd = 0;
+    if (anOp < 2)
+    {
+      anInd = anIMap.Add(aKey);
+      if (aFlatIMap.Add(aKey) != anInd || aFlatMap.Add(aKey) != aMap.Add(aKey))
+      {
+        std::cout << "Error: wrong result of Add() for key " << aKey << std::endl;
+        isOK = Standard_False;
+      }
+    }
+    else if (anOp == 2)
+    {
+      anInd = anIMap.FindIndex(aKey);
+      if (aFlatIMap.FindIndex(aKey) != anInd || aFlatMap.Contains(aKey) != aMap.Contains(aKey))
+      {
+        std::cout << "Error: wrong result of FindIndex() for key " << aKey << std::endl;
+        isOK = Standard_False;
+      }
+      if (anInd != 0)
+      {
+        anIMap.RemoveFromIndex(anInd);
+        aFlatIMap.RemoveFromIndex(anInd);
+      }
+      if (aFlatMap.Remove(aKey) != aMap.Remove(aKey))
+      {
+        std::cout << "Error: wrong result of Remove() for key " << aKey << std::endl;
+        isOK = Standard_False;
+      }
+    }
+    else if (!anIMap.IsEmpty())
+    {
+      anIMap.RemoveLast();
+      aFlatIMap.RemoveLast();
+    }
+    if (anIMap.Extent() != aFlatIMap.Extent() || aMap.Extent() != aFlatMap.Extent())
+    {
+      std::cout << "Error: wrong extent of flat map" << std::endl;
+      isOK = Standard_False;
+    }
+  }
+
+  for (Standard_Integer anIndex = 1; anIndex <= anIMap.Extent() && isOK; ++anIndex)
+  {
+    if (aFlatIMap.FindKey(anIndex) != anIMap.FindKey(anIndex)
+        || aFlatIMap.FindIndex(anIMap.FindKey(anIndex)) != anIndex)
+    {
+      std::cout << "Error: wrong key of flat indexed map at index " << anIndex << std::endl;
+      isOK = Standard_False;
+    }
+  }
+  for (NCollection_FlatMap<Standard_Integer>::Iterator anIter(aFlatMap); anIter.More() && isOK;
+       anIter.Next())
+  {
+    if (!aMap.Contains(anIter.Key()))
+    {
+      std::cout << "Error: flat map contains unexpected key " << anIter.Key() << std::endl;
+      isOK = Standard_False;
+    }
+  }
+
+  // copying and clearing
+  NCollection_FlatIndexedMap<Standard_Integer> aCopy(aFlatIMap);
+  aFlatIMap.Clear();
+  if (aCopy.Extent() != anIMap.Extent() || !aFlatIMap.IsEmpty() || aFlatIMap.Contains(aCopy(1)))
+  {
+    std::cout << "Error: wrong copy or clearing of flat indexed map" << std::endl;
+    isOK = Standard_False;
+  }
+
+  // moving and exchanging: the maps should never share their storage
+  auto isSameAsIMap = [&anIMap](const NCollection_FlatIndexedMap<Standard_Integer>& theMap) {
+    if (theMap.Extent() != anIMap.Extent())
+    {
+      return Standard_False;
+    }
+    for (Standard_Integer anIndex = 1; anIndex <= anIMap.Extent(); ++anIndex)
+    {
+      if (theMap.FindKey(anIndex) != anIMap.FindKey(anIndex)
+          || theMap.FindIndex(anIMap.FindKey(anIndex)) != anIndex)
+      {
+        return Standard_False;
+      }
+    }
+    return Standard_True;
+  };
+  NCollection_FlatIndexedMap<Standard_Integer> aMoved(std::move(aCopy));
+  aCopy.Add(-1);
+  NCollection_FlatIndexedMap<Standard_Integer> anAssigned(4);
+  anAssigned.Add(-2);
+  anAssigned = std::move(aMoved);
+  aMoved.Clear();
+  aMoved.Add(-3);
+  if (!isSameAsIMap(anAssigned) || aCopy.Extent() != 1 || aCopy(1) != -1 || aMoved.Extent() != 1
+      || aMoved(1) != -3 || anAssigned.Contains(-1) || anAssigned.Contains(-3))
+  {
+    std::cout << "Error: moved flat indexed map shares data with its source" << std::endl;
+    isOK = Standard_False;
+  }
+  aCopy.Exchange(anAssigned);
+  anAssigned.Add(-4);
+  if (!isSameAsIMap(aCopy) || anAssigned.Extent() != 2 || anAssigned.FindIndex(-1) != 1
+      || aCopy.Contains(-4))
+  {
+    std::cout << "Error: wrong exchange of flat indexed maps" << std::endl;
+    isOK = Standard_False;
+  }
+
+  NCollection_FlatMap<Standard_Integer> aFlatMoved(std::move(aFlatMap));
+  aFlatMap.Add(-1);
+  NCollection_FlatMap<Standard_Integer> aFlatAssigned;
+  aFlatAssigned.Add(-2);
+  aFlatAssigned = std::move(aFlatMoved);
+  aFlatMoved.Add(-3);
+  if (aFlatAssigned.Extent() != aMap.Extent() || aFlatAssigned.Contains(-1)
+      || aFlatAssigned.Contains(-2) || aFlatAssigned.Contains(-3) || aFlatMap.Extent() != 1
+      || aFlatMoved.Extent() != 1)
+  {
+    std::cout << "Error: moved flat map shares data with its source" << std::endl;
+    isOK = Standard_False;
+  }
+  aFlatAssigned.Exchange(aFlatMap);
+  if (aFlatMap.Extent() != aMap.Extent() || aFlatAssigned.Extent() != 1
+      || !aFlatAssigned.Contains(-1))
+  {
+    std::cout << "Error: wrong exchange of flat maps" << std::endl;
+    isOK = Standard_False;
+  }
+
+  if (isOK)
+  {
+    std::cout << "Test OK" << std::endl;
+  }
+  return 0;
+}
+
+//=================================================================================================
+
 static Standard_Integer QANColTestList(DrawInterpreter& di,
                                        Standard_Integer  argc,
                                        const char**      argv)
@@ -1446,6 +1600,11 @@ void QANCollection1::CommandsTest(DrawInterpreter& theCommands)
                   __FILE__,
                   QANColTestIndexedDataMap,
                   group);
+  theCommands.Add("QANColTestFlatMap",
+                  "QANColTestFlatMap : checks flat maps against node-based ones",
+                  __FILE__,
+                  QANColTestFlatMap,
+                  group);
   theCommands.Add("QANColTestList", "QANColTestList", __FILE__, QANColTestList, group);
   theCommands.Add("QANColTestSequence", "QANColTestSequence", __FILE__, QANColTestSequence, group);
   theCommands.Add("QANColTestVector", "QANColTestVector", __FILE__, QANColTestVector, group);
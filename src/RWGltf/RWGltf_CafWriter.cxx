@@ -55,33 +55,6 @@ IMPLEMENT_STANDARD_RTTIEXT(GLTFCafWriter, RefObject)
 
 namespace
 {
-//! Write three float values.
-static void writeVec3(std::ostream& theStream, const Coords3d& theVec3)
-{
-  Graphic3d_Vec3 aVec3(float(theVec3.X()), float(theVec3.Y()), float(theVec3.Z()));
-  theStream.write((const char*)aVec3.GetData(), sizeof(aVec3));
-}
-
-//! Write three float values.
-static void writeVec3(std::ostream& theStream, const Graphic3d_Vec3& theVec3)
-{
-  theStream.write((const char*)theVec3.GetData(), sizeof(theVec3));
-}
-
-//! Write two float values.
-static void writeVec2(std::ostream& theStream, const Coords2d& theVec2)
-{
-  Graphic3d_Vec2 aVec2(float(theVec2.X()), float(theVec2.Y()));
-  theStream.write((const char*)aVec2.GetData(), sizeof(aVec2));
-}
-
-//! General function to write triangle indices.
-template <typename VecType>
-static void writeTriangle(std::ostream& theStream, const VecType& theTri)
-{
-  theStream.write(reinterpret_cast<const char*>(theTri.GetData()), sizeof(theTri));
-}
-
 //! General function to write vertex index.
 template <typename T>
 static void writeVertex(std::ostream& theStream, const T& theVertex)
@@ -89,6 +62,17 @@ static void writeVertex(std::ostream& theStream, const T& theVertex)
   theStream.write(reinterpret_cast<const char*>(&theVertex), sizeof(T));
 }
 
+//! General function to write a buffer of values at once.
+template <typename T>
+static void writeBuffer(std::ostream& theStream, const std::vector<T>& theBuffer)
+{
+  if (!theBuffer.empty())
+  {
+    theStream.write(reinterpret_cast<const char*>(theBuffer.data()),
+                    std::streamsize(theBuffer.size() * sizeof(T)));
+  }
+}
+
 #ifdef HAVE_DRACO
 //! Write nodes to Draco mesh
 static void writeNodesToDracoMesh(draco::Mesh1& theMesh, const std::vector<Graphic3d_Vec3>& theNodes)
@@ -329,21 +313,41 @@ void GLTFCafWriter::saveNodes(RWGltf_GltfFace&                               the
   }
   theGltfFace.NodePos.Count += theShapeIter.NbNodes();
 
+  const bool toWriteBin = theMesh.get() == nullptr || !hasTriangulation(theGltfFace);
+  const RWMesh_FaceIterator* aFaceIter = dynamic_cast<const RWMesh_FaceIterator*>(&theShapeIter);
+  if (toWriteBin && aFaceIter != nullptr && !aFaceIter->Triangulation()->IsDoublePrecision()
+      && myCSTrsf.IsEmpty() && theShapeIter.Transformation().Form() == gp_Identity)
+  {
+    // single precision nodes without transformation are written as is
+    const NCollection_AliasedArray<>& aNodes = aFaceIter->Triangulation()->InternalNodes();
+    for (Standard_Integer aNodeIter = 0; aNodeIter < aNodes.Length(); ++aNodeIter)
+    {
+      const gp_Vec3f& aNode = aNodes.Value<gp_Vec3f>(aNodeIter);
+      theGltfFace.NodePos.BndBox.Add(Graphic3d_Vec3d(aNode.x(), aNode.y(), aNode.z()));
+    }
+    if (!aNodes.IsEmpty())
+    {
+      theBinFile.write(reinterpret_cast<const char*>(&aNodes.Value<gp_Vec3f>(0)),
+                       std::streamsize(aNodes.Length() * sizeof(gp_Vec3f)));
+    }
+    return;
+  }
+
+  // nodes to be written are collected into a buffer to write them at once
+  std::vector<Graphic3d_Vec3>  aBuffer;
+  std::vector<Graphic3d_Vec3>& aNodes = toWriteBin ? aBuffer : theMesh->NodesVec;
+  aNodes.reserve(aNodes.size() + theShapeIter.NbNodes());
   const Standard_Integer aNodeUpper = theShapeIter.NodeUpper();
   for (Standard_Integer aNodeIter = theShapeIter.NodeLower(); aNodeIter <= aNodeUpper; ++aNodeIter)
   {
     Coords3d aNode = theShapeIter.NodeTransformed(aNodeIter).XYZ();
     myCSTrsf.TransformPosition(aNode);
     theGltfFace.NodePos.BndBox.Add(Graphic3d_Vec3d(aNode.X(), aNode.Y(), aNode.Z()));
-    if (theMesh.get() != nullptr && hasTriangulation(theGltfFace))
-    {
-      theMesh->NodesVec.push_back(
-        Graphic3d_Vec3(float(aNode.X()), float(aNode.Y()), float(aNode.Z())));
-    }
-    else
-    {
-      writeVec3(theBinFile, aNode);
-    }
+    aNodes.push_back(Graphic3d_Vec3(float(aNode.X()), float(aNode.Y()), float(aNode.Z())));
+  }
+  if (toWriteBin)
+  {
+    writeBuffer(theBinFile, aBuffer);
   }
 }
 
@@ -378,21 +382,18 @@ void GLTFCafWriter::saveNormals(RWGltf_GltfFace&                               t
   }
   theGltfFace.NodeNorm.Count += theFaceIter.NbNodes();
 
+  std::vector<Graphic3d_Vec3>  aBuffer;
+  std::vector<Graphic3d_Vec3>& aNormals = theMesh.get() == nullptr ? aBuffer : theMesh->NormalsVec;
+  aNormals.reserve(aNormals.size() + theFaceIter.NbNodes());
   const Standard_Integer aNodeUpper = theFaceIter.NodeUpper();
   for (Standard_Integer aNodeIter = theFaceIter.NodeLower(); aNodeIter <= aNodeUpper; ++aNodeIter)
   {
     const Dir3d   aNormal = theFaceIter.NormalTransformed(aNodeIter);
     Graphic3d_Vec3 aVecNormal((float)aNormal.X(), (float)aNormal.Y(), (float)aNormal.Z());
     myCSTrsf.TransformNormal(aVecNormal);
-    if (theMesh.get() != nullptr)
-    {
-      theMesh->NormalsVec.push_back(aVecNormal);
-    }
-    else
-    {
-      writeVec3(theBinFile, aVecNormal);
-    }
+    aNormals.push_back(aVecNormal);
   }
+  writeBuffer(theBinFile, aBuffer);
 }
 
 //=================================================================================================
@@ -442,20 +443,18 @@ void GLTFCafWriter::saveTextCoords(RWGltf_GltfFace&
   }
   theGltfFace.NodeUV.Count += theFaceIter.NbNodes();
 
+  std::vector<Graphic3d_Vec2>  aBuffer;
+  std::vector<Graphic3d_Vec2>& aTexCoords =
+    theMesh.get() == nullptr ? aBuffer : theMesh->TexCoordsVec;
+  aTexCoords.reserve(aTexCoords.size() + theFaceIter.NbNodes());
   const Standard_Integer aNodeUpper = theFaceIter.NodeUpper();
   for (Standard_Integer aNodeIter = theFaceIter.NodeLower(); aNodeIter <= aNodeUpper; ++aNodeIter)
   {
     gp_Pnt2d aTexCoord = theFaceIter.NodeTexCoord(aNodeIter);
     aTexCoord.SetY(1.0 - aTexCoord.Y());
-    if (theMesh.get() != nullptr)
-    {
-      theMesh->TexCoordsVec.push_back(Graphic3d_Vec2((float)aTexCoord.X(), (float)aTexCoord.Y()));
-    }
-    else
-    {
-      writeVec2(theBinFile, aTexCoord.XY());
-    }
+    aTexCoords.push_back(Graphic3d_Vec2((float)aTexCoord.X(), (float)aTexCoord.Y()));
   }
+  writeBuffer(theBinFile, aBuffer);
 }
 
 //=================================================================================================
@@ -468,6 +467,23 @@ void GLTFCafWriter::saveTriangleIndices(RWGltf_GltfFace&           theGltfFace,
   const Standard_Integer aNodeFirst = theGltfFace.NbIndexedNodes - theFaceIter.ElemLower();
   theGltfFace.NbIndexedNodes += theFaceIter.NbNodes();
   theGltfFace.Indices.Count += theFaceIter.NbTriangles() * 3;
+
+  // indices are collected into a buffer of the required type to write them at once
+  const bool isShort = theGltfFace.Indices.ComponentType == RWGltf_GltfAccessorCompType_UInt16;
+  std::vector<NCollection_Vec3<uint16_t>> aShortBuffer;
+  std::vector<Graphic3d_Vec3i>            anIntBuffer;
+  if (theMesh.get() != nullptr)
+  {
+    theMesh->IndicesVec.reserve(theMesh->IndicesVec.size() + theFaceIter.NbTriangles());
+  }
+  else if (isShort)
+  {
+    aShortBuffer.reserve(theFaceIter.NbTriangles());
+  }
+  else
+  {
+    anIntBuffer.reserve(theFaceIter.NbTriangles());
+  }
   for (Standard_Integer anElemIter = theFaceIter.ElemLower(); anElemIter <= theFaceIter.ElemUpper();
        ++anElemIter)
   {
@@ -479,20 +495,18 @@ void GLTFCafWriter::saveTriangleIndices(RWGltf_GltfFace&           theGltfFace,
     {
       theMesh->IndicesVec.push_back(aTri);
     }
+    else if (isShort)
+    {
+      aShortBuffer.push_back(
+        NCollection_Vec3<uint16_t>((uint16_t)aTri(1), (uint16_t)aTri(2), (uint16_t)aTri(3)));
+    }
     else
     {
-      if (theGltfFace.Indices.ComponentType == RWGltf_GltfAccessorCompType_UInt16)
-      {
-        writeTriangle(
-          theBinFile,
-          NCollection_Vec3<uint16_t>((uint16_t)aTri(1), (uint16_t)aTri(2), (uint16_t)aTri(3)));
-      }
-      else
-      {
-        writeTriangle(theBinFile, Graphic3d_Vec3i(aTri(1), aTri(2), aTri(3)));
-      }
+      anIntBuffer.push_back(Graphic3d_Vec3i(aTri(1), aTri(2), aTri(3)));
     }
   }
+  writeBuffer(theBinFile, aShortBuffer);
+  writeBuffer(theBinFile, anIntBuffer);
 }
 
 //=================================================================================================
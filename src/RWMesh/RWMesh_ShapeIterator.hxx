@@ -73,6 +73,9 @@ public:
   //! Upper node index in current shape.
   Standard_EXPORT virtual Standard_Integer NodeUpper() const = 0;
 
+  //! Return transformation of the current shape.
+  const Transform3d& Transformation() const { return myTrsf; }
+
   //! Return the node with specified index with applied transformation.
   Point3d NodeTransformed(const Standard_Integer theNode) const
   {
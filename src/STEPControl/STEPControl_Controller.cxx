@@ -191,6 +191,14 @@ STEPControl_Controller::STEPControl_Controller()
     ExchangeConfig::Init("step", "write.step.vertex.mode", '&', "eval Single Vertex");
     ExchangeConfig::SetIVal("write.step.vertex.mode", 0);
 
+    // Parameter to format the entities of the DATA section by several threads (Off by default),
+    // the written file does not depend on it
+    ExchangeConfig::Init("step", "write.step.parallel", 'e', "");
+    ExchangeConfig::Init("step", "write.step.parallel", '&', "enum 0");
+    ExchangeConfig::Init("step", "write.step.parallel", '&', "eval Off");
+    ExchangeConfig::Init("step", "write.step.parallel", '&', "eval On");
+    ExchangeConfig::SetIVal("write.step.parallel", 0);
+
     // abv 15.11.00: ShapeProcessing
     ExchangeConfig::Init("XSTEP", "write.step.resource.name", 't', "STEP");
     ExchangeConfig::Init("XSTEP", "read.step.resource.name", 't', "STEP");
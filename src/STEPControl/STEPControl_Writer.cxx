@@ -16,6 +16,7 @@
 #include <APIHeaderSection_MakeHeader.hxx>
 #include <DE_ShapeFixParameters.hxx>
 #include <Interface_InterfaceModel.hxx>
+#include <Interface_Static.hxx>
 #include <Interface_Macros.hxx>
 #include <STEPControl_ActorWrite.hxx>
 #include <STEPControl_Controller.hxx>
@@ -183,6 +184,7 @@ IFSelect_ReturnStatus StepFileWriter::WriteStream(std::ostream& theOStream)
   }
 
   StepData_StepWriter aWriter(aModel);
+  aWriter.SetParallel(ExchangeConfig::IVal("write.step.parallel") == 1);
   aWriter.SendModel(aProtocol);
   APIHeaderSection_MakeHeader aHeaderMaker;
   aHeaderMaker.Apply(aModel);
@@ -16,6 +16,7 @@
 #define _Standard_Transient_HeaderFile
 
 #include <Standard.hxx>
+#include <Standard_Config.hxx>
 #include <Standard_DefineAlloc.hxx>
 #include <Standard_PrimitiveTypes.hxx>
 
@@ -100,11 +101,11 @@ public:
   inline Standard_Integer GetRefCount() const noexcept { return myRefCount_; }
 
   //! Increments the reference counter of this object
-  inline void IncrementRefCounter() noexcept { myRefCount_.operator++(); }
+  inline void IncrementRefCounter() noexcept { ++myRefCount_; }
 
   //! Decrements the reference counter of this object;
   //! returns the decremented value
-  inline Standard_Integer DecrementRefCounter() noexcept { return myRefCount_.operator--(); }
+  inline Standard_Integer DecrementRefCounter() noexcept { return --myRefCount_; }
 
   //! Memory deallocator for transient classes
   virtual void Delete() const { delete this; }
@@ -113,7 +114,16 @@ private:
   //! Reference1 counter.
   //! Note use of underscore, aimed to reduce probability
   //! of conflict with names of members of derived classes.
+  //! When OCCT_NONATOMIC_REFCOUNT macro is defined in generated Standard_Config.hxx
+  //! (see BUILD_NONATOMIC_REFCOUNT CMake option) the counter is a plain integer:
+  //! handles become cheaper to copy, but the same object must not be shared
+  //! by handles in different threads; OSD_Parallel and OSD_ThreadPool then
+  //! execute all the work in the calling thread.
+#ifdef OCCT_NONATOMIC_REFCOUNT
+  Standard_Integer myRefCount_;
+#else
   std::atomic_int myRefCount_;
+#endif
 };
 
 //! Definition of Handle_RefObject as typedef for compatibility
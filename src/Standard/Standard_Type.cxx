@@ -24,12 +24,21 @@ IMPLEMENT_STANDARD_RTTIEXT(TypeInfo, RefObject)
 TypeInfo::TypeInfo(const char*                  theSystemName,
                              const char*                  theName,
                              Standard_Size                theSize,
-                             const Handle(TypeInfo)& theParent)
+                             const Handle(TypeInfo)& theParent,
+                             const TypeInfo**        theAncestors)
     : mySystemName(theSystemName),
       myName(theName),
       mySize(theSize),
-      myParent(theParent)
+      myParent(theParent),
+      myDepth(theParent.IsNull() ? 0 : theParent->myDepth + 1),
+      myAncestors(theAncestors)
 {
+  // the ancestors of the parent are the ancestors of this type as well
+  for (Standard_Integer aDepth = 0; aDepth < myDepth; ++aDepth)
+  {
+    myAncestors[aDepth] = theParent->myAncestors[aDepth];
+  }
+  myAncestors[myDepth] = this;
 }
 
 Standard_Boolean TypeInfo::SubType(const Handle(TypeInfo)& theOther) const
@@ -38,16 +47,7 @@ Standard_Boolean TypeInfo::SubType(const Handle(TypeInfo)& theOther) const
   {
     return false;
   }
-  const TypeInfo* aTypeIter = this;
-  while (aTypeIter && theOther->mySize <= aTypeIter->mySize)
-  {
-    if (theOther.get() == aTypeIter)
-    {
-      return true;
-    }
-    aTypeIter = aTypeIter->Parent().get();
-  }
-  return false;
+  return theOther->myDepth <= myDepth && myAncestors[theOther->myDepth] == theOther.get();
 }
 
 Standard_Boolean TypeInfo::SubType(const Standard_CString theName) const
@@ -126,23 +126,28 @@ TypeInfo* TypeInfo::Register(const std::type_info&        theInfo,
     return aType;
   }
 
-  // Calculate sizes for deep copies
-  const Standard_Size anInfoNameLen = strlen(theInfo.name()) + 1;
-  const Standard_Size aNameLen      = strlen(theName) + 1;
+  // Calculate sizes for deep copies and for the ancestors array
+  const Standard_Size anInfoNameLen  = strlen(theInfo.name()) + 1;
+  const Standard_Size aNameLen       = strlen(theName) + 1;
+  const Standard_Size anAncestorsLen =
+    sizeof(TypeInfo*) * (theParent.IsNull() ? 1 : theParent->Depth() + 2);
 
-  // Allocate memory block for TypeInfo and the two strings
-  char* aMemoryBlock =
-    static_cast<char*>(Standard1::AllocateOptimal(sizeof(TypeInfo) + anInfoNameLen + aNameLen));
+  // Allocate memory block for TypeInfo, the ancestors and the two strings
+  char* aMemoryBlock = static_cast<char*>(
+    Standard1::AllocateOptimal(sizeof(TypeInfo) + anAncestorsLen + anInfoNameLen + aNameLen));
 
-  // Pointers to the locations for the deep copies of the strings
-  char* anInfoNameCopy = aMemoryBlock + sizeof(TypeInfo);
+  // Pointers to the locations for the ancestors and the deep copies of the strings
+  const TypeInfo** anAncestors =
+    reinterpret_cast<const TypeInfo**>(aMemoryBlock + sizeof(TypeInfo));
+  char* anInfoNameCopy = aMemoryBlock + sizeof(TypeInfo) + anAncestorsLen;
   char* aNameCopy      = anInfoNameCopy + anInfoNameLen;
 
   // Deep copy the strings using strncpy
   strncpy(anInfoNameCopy, theInfo.name(), anInfoNameLen);
   strncpy(aNameCopy, theName, aNameLen);
 
-  aType = new (aMemoryBlock) TypeInfo(anInfoNameCopy, aNameCopy, theSize, theParent);
+  aType =
+    new (aMemoryBlock) TypeInfo(anInfoNameCopy, aNameCopy, theSize, theParent, anAncestors);
 
   // Insert the descriptor into the registry
   aRegistry.Bind(anInfoNameCopy, aType);
@@ -132,8 +132,13 @@ public:
   //! Returns descriptor of the base class in the hierarchy
   const Handle(TypeInfo)& Parent() const { return myParent; }
 
+  //! Returns the depth of the type in the hierarchy (0 for RefObject)
+  Standard_Integer Depth() const { return myDepth; }
+
   //! Returns True if this type is the same as theOther, or inherits from theOther.
   //! Note that multiple inheritance is not supported.
+  //! The check takes constant time, comparing theOther with the ancestor
+  //! of this type at the depth of theOther.
   Standard_EXPORT Standard_Boolean SubType(const Handle(TypeInfo)& theOther) const;
 
   //! Returns True if this type is the same as theOther, or inherits from theOther.
@@ -175,16 +180,22 @@ public:
 
 private:
   //! Constructor is private
+  //! The array theAncestors should have room for the parent depth + 2 items.
   TypeInfo(const char*                  theSystemName,
                 const char*                  theName,
                 Standard_Size                theSize,
-                const Handle(TypeInfo)& theParent);
+                const Handle(TypeInfo)& theParent,
+                const TypeInfo**        theAncestors);
 
 private:
   Standard_CString      mySystemName; //!< System name of the class
   Standard_CString      myName;       //!< Given name of the class
   Standard_Size         mySize;       //!< Size of the class instance, in bytes
   Handle(TypeInfo) myParent;     //!< Type descriptor of parent class
+  Standard_Integer      myDepth;      //!< Number of ancestors of the class
+  // clang-format off
+  const TypeInfo**      myAncestors;  //!< Type descriptors of the ancestors indexed by their depth, ending by this one
+  // clang-format on
 };
 
 //! Operator printing type descriptor to stream
@@ -24,3 +24,12 @@ void StdDrivers_DocumentRetrievalDriver::bindTypes(MapOfInstantiators& theMap)
 {
   StdDrivers1::BindTypes(theMap);
 }
+
+//=================================================================================================
+
+Handle(PCDM_RetrievalDriver) StdDrivers_DocumentRetrievalDriver::Copy() const
+{
+  Handle(StdDrivers_DocumentRetrievalDriver) aCopy = new StdDrivers_DocumentRetrievalDriver();
+  aCopy->SetFormat(GetFormat());
+  return aCopy;
+}
@@ -20,6 +20,9 @@
 class StdDrivers_DocumentRetrievalDriver : public StdLDrivers_DocumentRetrievalDriver
 {
 public:
+  //! Returns a new driver of the same type, with the format and options of this driver.
+  Standard_EXPORT virtual Handle(PCDM_RetrievalDriver) Copy() const Standard_OVERRIDE;
+
   DEFINE_STANDARD_RTTIEXT(StdDrivers_DocumentRetrievalDriver, StdLDrivers_DocumentRetrievalDriver)
 
 protected:
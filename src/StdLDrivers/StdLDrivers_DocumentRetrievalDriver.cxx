@@ -309,3 +309,12 @@ void StdLDrivers_DocumentRetrievalDriver::bindTypes(MapOfInstantiators& theMap)
 {
   StdLDrivers1::BindTypes(theMap);
 }
+
+//=================================================================================================
+
+Handle(PCDM_RetrievalDriver) StdLDrivers_DocumentRetrievalDriver::Copy() const
+{
+  Handle(StdLDrivers_DocumentRetrievalDriver) aCopy = new StdLDrivers_DocumentRetrievalDriver();
+  aCopy->SetFormat(GetFormat());
+  return aCopy;
+}
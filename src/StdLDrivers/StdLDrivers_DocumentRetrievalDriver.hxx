@@ -41,6 +41,9 @@ public:
     const Handle(ReaderFilter)& theFilter = Handle(ReaderFilter)(),
     const Message_ProgressRange&     theRange  = Message_ProgressRange()) Standard_OVERRIDE;
 
+  //! Returns a new driver of the same type, with the format and options of this driver.
+  Standard_EXPORT virtual Handle(PCDM_RetrievalDriver) Copy() const Standard_OVERRIDE;
+
   DEFINE_STANDARD_RTTIEXT(StdLDrivers_DocumentRetrievalDriver, PCDM_RetrievalDriver)
 
 protected:
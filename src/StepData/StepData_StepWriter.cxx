@@ -20,6 +20,8 @@
 #include <Interface_InterfaceMismatch.hxx>
 #include <Interface_Macros.hxx>
 #include <Interface_ReportEntity.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_Parallel.hxx>
 #include <Standard_Transient.hxx>
 #include <StepData_ESDescr.hxx>
 #include <StepData_FieldList.hxx>
@@ -35,10 +37,17 @@
 #include <TCollection_AsciiString.hxx>
 #include <TCollection_HAsciiString.hxx>
 
+#include <memory>
 #include <stdio.h>
 #define StepLong 72
 // StepLong : longueur maxi d une ligne de fichier Step
 
+//! Minimal number of entities formatted by one thread, see SendEntitiesParallel()
+static const Standard_Integer THE_MIN_NB_ENTITIES_PER_RANGE = 2000;
+
+//! Size of the blocks of memory keeping the lines of the produced text
+static const size_t THE_TEXT_BLOCK_SIZE = 1024 * 1024;
+
 //  Constantes litterales (interessantes, pour les performances ET LA MEMOIRE)
 
 static AsciiString1 textscope(" &SCOPE");
@@ -63,13 +72,14 @@ StepData_StepWriter::StepData_StepWriter(const Handle(StepData_StepModel)& amode
 {
   themodel   = amodel;
   thelabmode = thetypmode = 0;
-  thefile                 = new TColStd_HSequenceOfHAsciiString();
+  thealloc                = new NCollection_IncAllocator(THE_TEXT_BLOCK_SIZE);
   thesect                 = Standard_False;
   thefirst                = Standard_True;
   themult                 = Standard_False;
   thecomm                 = Standard_False;
   thelevel = theindval = 0;
   theindent            = Standard_False;
+  theparallel          = Standard_False;
   //  Format flottant : reporte dans le FloatWriter
 }
 
@@ -153,7 +163,7 @@ void StepData_StepWriter::SendModel(const Handle(StepData_Protocol)& protocol,
   StepData_WriterLib lib(protocol);
 
   if (!headeronly)
-    thefile->Append(new TCollection_HAsciiString("ISO-10303-21;"));
+    AddLine("ISO-10303-21;", 13);
   SendHeader();
 
   //  ....                Header : suite d entites sans Ident                ....
@@ -223,8 +233,22 @@ void StepData_StepWriter::SendModel(const Handle(StepData_Protocol)& protocol,
 
   //  ....                Sortie des Entites une par une                ....
 
-  Standard_Integer nb = themodel->NbEntities();
-  for (Standard_Integer i = 1; i <= nb; i++)
+  if (theparallel)
+    SendEntitiesParallel(lib);
+  else
+    SendEntities(lib, 1, themodel->NbEntities());
+
+  EndSec();
+  EndFile();
+}
+
+//=================================================================================================
+
+void StepData_StepWriter::SendEntities(const StepData_WriterLib& theLib,
+                                       const Standard_Integer    theFirst,
+                                       const Standard_Integer    theLast)
+{
+  for (Standard_Integer i = theFirst; i <= theLast; i++)
   {
     //    Liste principale : on n envoie pas les Entites dans un Scope
     //    Elles le seront par l intermediaire du Scope qui les contient
@@ -233,11 +257,82 @@ void StepData_StepWriter::SendModel(const Handle(StepData_Protocol)& protocol,
       if (thescopenext->Value(i) != 0)
         continue;
     }
-    SendEntity(i, lib);
+    SendEntity(i, theLib);
   }
+}
 
-  EndSec();
-  EndFile();
+//=================================================================================================
+
+void StepData_StepWriter::SendEntitiesParallel(const StepData_WriterLib& theLib)
+{
+  const Standard_Integer aNbEntities = themodel->NbEntities();
+  const Standard_Integer aNbRanges =
+    Min(aNbEntities / THE_MIN_NB_ENTITIES_PER_RANGE, 4 * Parallel1::NbLogicalProcessors());
+  // the lines of an entity depend on the state left by the previous one only
+  // when the entities are indented (see Indent())
+  if (aNbRanges < 2 || theindent)
+  {
+    SendEntities(theLib, 1, aNbEntities);
+    return;
+  }
+
+  // the entities refer to each other by their numbers in the model, so that each range
+  // can be formatted by its own writer with the same options
+  NCollection_Array1<std::unique_ptr<StepData_StepWriter>> aRangeWriters(0, aNbRanges - 1);
+  for (Standard_Integer aRange = 0; aRange < aNbRanges; ++aRange)
+  {
+    StepData_StepWriter* aWriter = new StepData_StepWriter(themodel);
+    aWriter->thelabmode          = thelabmode;
+    aWriter->thetypmode          = thetypmode;
+    aWriter->thefloatw           = thefloatw;
+    aWriter->thescopebeg         = thescopebeg;
+    aWriter->thescopeend         = thescopeend;
+    aWriter->thescopenext        = thescopenext;
+    aWriter->thesect             = Standard_True;
+    aRangeWriters.ChangeValue(aRange).reset(aWriter);
+  }
+  Parallel1::For(0, aNbRanges, [&](const Standard_Integer theRange) {
+    aRangeWriters.Value(theRange)->SendEntities(
+      theLib,
+      1 + (Standard_Integer)((Standard_Size)aNbEntities * theRange / aNbRanges),
+      (Standard_Integer)((Standard_Size)aNbEntities * (theRange + 1) / aNbRanges));
+  });
+
+  // the lines stay in the memory of the range writers
+  for (Standard_Integer aRange = 0; aRange < aNbRanges; ++aRange)
+  {
+    StepData_StepWriter& aWriter = *aRangeWriters.Value(aRange);
+    for (NCollection_Vector<TextLine>::Iterator aLineIter(aWriter.thefile); aLineIter.More();
+         aLineIter.Next())
+    {
+      thefile.Append(aLineIter.Value());
+    }
+    thestorages.Append(aWriter.thealloc);
+    thechecks.Merge(aWriter.thechecks);
+  }
+}
+
+//=================================================================================================
+
+void StepData_StepWriter::FlushLine()
+{
+  TextLine aLine;
+  aLine.Text = thecurr.Moved(thealloc, aLine.Length);
+  thefile.Append(aLine);
+}
+
+//=================================================================================================
+
+void StepData_StepWriter::AddLine(const Standard_CString theText, const Standard_Integer theLength)
+{
+  char* aText = (char*)thealloc->Allocate(theLength + 1);
+  memcpy(aText, theText, theLength);
+  aText[theLength] = '\0';
+
+  TextLine aLine;
+  aLine.Text   = aText;
+  aLine.Length = theLength;
+  thefile.Append(aLine);
 }
 
 //  ....                DECOUPAGE DU FICHIER EN SECTIONS                ....
@@ -247,7 +342,7 @@ void StepData_StepWriter::SendModel(const Handle(StepData_Protocol)& protocol,
 void StepData_StepWriter::SendHeader()
 {
   NewLine(Standard_False);
-  thefile->Append(new TCollection_HAsciiString("HEADER;"));
+  AddLine("HEADER;", 7);
   thesect = Standard_True;
 }
 
@@ -258,7 +353,7 @@ void StepData_StepWriter::SendData()
   if (thesect)
     throw Interface_InterfaceMismatch("StepWriter : Data section");
   NewLine(Standard_False);
-  thefile->Append(new TCollection_HAsciiString("DATA;"));
+  AddLine("DATA;", 5);
   thesect = Standard_True;
 }
 
@@ -266,7 +361,7 @@ void StepData_StepWriter::SendData()
 
 void StepData_StepWriter::EndSec()
 {
-  thefile->Append(new TCollection_HAsciiString("ENDSEC;"));
+  AddLine("ENDSEC;", 7);
   thesect = Standard_False;
 }
 
@@ -277,7 +372,7 @@ void StepData_StepWriter::EndFile()
   if (thesect)
     throw Interface_InterfaceMismatch("StepWriter : EndFile");
   NewLine(Standard_False);
-  thefile->Append(new TCollection_HAsciiString("END-ISO-10303-21;"));
+  AddLine("END-ISO-10303-21;", 17);
   thesect = Standard_False;
 }
 
@@ -412,7 +507,7 @@ void StepData_StepWriter::NewLine(const Standard_Boolean evenempty)
 {
   if (evenempty || thecurr.Length() > 0)
   {
-    thefile->Append(thecurr.Moved());
+    FlushLine();
   }
   Standard_Integer indst = thelevel * 2;
   if (theindent)
@@ -462,7 +557,7 @@ void StepData_StepWriter::SendScope()
 void StepData_StepWriter::SendEndscope()
 {
   NewLine(Standard_False);
-  thefile->Append(new TCollection_HAsciiString(textendscope));
+  AddLine(textendscope.ToCString(), textendscope.Length());
 }
 
 //=================================================================================================
@@ -878,7 +973,7 @@ void StepData_StepWriter::Send(const AsciiString1& val)
   //: i2
   else
   {
-    thefile->Append(thecurr.Moved());
+    FlushLine();
     Standard_Integer indst = thelevel * 2;
     if (theindent)
       indst += theindval;
@@ -916,7 +1011,7 @@ void StepData_StepWriter::Send(const AsciiString1& val)
           }
         }
         AsciiString1 bval = aval.Split(stop);
-        thefile->Append(new TCollection_HAsciiString(aval));
+        AddLine(aval.ToCString(), aval.Length());
         aval = bval;
         nn -= stop;
       }
@@ -928,7 +1023,7 @@ void StepData_StepWriter::Send(const AsciiString1& val)
       Standard_Integer ncurr = thecurr.Length();
       Standard_Integer nbuff = StepLong - ncurr;
       thecurr.Add (aval.ToCString(),nbuff);
-      thefile->Append(thecurr.Moved());
+      FlushLine();
       aval.Remove(1,nbuff);
       nn -= nbuff;
       while (nn > 0) {
@@ -938,7 +1033,7 @@ void StepData_StepWriter::Send(const AsciiString1& val)
       break;
         }
         AsciiString1 bval = aval.Split(StepLong);
-        thefile->Append(new TCollection_HAsciiString(bval));
+        AddLine(bval.ToCString(), bval.Length());
         nn -= StepLong;
       }
     }
@@ -1151,7 +1246,7 @@ void StepData_StepWriter::AddString(const AsciiString1& astr,
 {
   while (!thecurr.CanGet(astr.Length() + more))
   {
-    thefile->Append(thecurr.Moved());
+    FlushLine();
     Standard_Integer indst = thelevel * 2;
     if (theindent)
       indst += theindval;
@@ -1168,7 +1263,7 @@ void StepData_StepWriter::AddString(const Standard_CString astr,
 {
   while (!thecurr.CanGet(lnstr + more))
   {
-    thefile->Append(thecurr.Moved());
+    FlushLine();
     Standard_Integer indst = thelevel * 2;
     if (theindent)
       indst += theindval;
@@ -1190,14 +1285,14 @@ Interface_CheckIterator StepData_StepWriter::CheckList() const
 
 Standard_Integer StepData_StepWriter::NbLines() const
 {
-  return thefile->Length();
+  return thefile.Length();
 }
 
 //=================================================================================================
 
 Handle(TCollection_HAsciiString) StepData_StepWriter::Line(const Standard_Integer num) const
 {
-  return thefile->Value(num);
+  return new TCollection_HAsciiString(thefile.Value(num - 1).Text);
 }
 
 //=================================================================================================
@@ -1205,9 +1300,13 @@ Handle(TCollection_HAsciiString) StepData_StepWriter::Line(const Standard_Intege
 Standard_Boolean StepData_StepWriter::Print(Standard_OStream& S)
 {
   Standard_Boolean isGood = (S.good());
-  Standard_Integer nb     = thefile->Length();
-  for (Standard_Integer i = 1; i <= nb && isGood; i++)
-    S << thefile->Value(i)->ToCString() << "\n";
+  for (NCollection_Vector<TextLine>::Iterator aLineIter(thefile); aLineIter.More() && isGood;
+       aLineIter.Next())
+  {
+    const TextLine& aLine = aLineIter.Value();
+    S.write(aLine.Text, aLine.Length);
+    S.put('\n');
+  }
 
   S << std::flush;
   isGood = (S && S.good());
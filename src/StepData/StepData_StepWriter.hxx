@@ -23,6 +23,9 @@
 
 #include <TColStd_HSequenceOfHAsciiString.hxx>
 #include <Interface_LineBuffer.hxx>
+#include <NCollection_IncAllocator.hxx>
+#include <NCollection_List.hxx>
+#include <NCollection_Vector.hxx>
 #include <Standard_Integer.hxx>
 #include <Interface_FloatWriter.hxx>
 #include <Interface_CheckIterator.hxx>
@@ -88,6 +91,15 @@ public:
   //! Returns True if an Entity identified by its Number is in a Scope
   Standard_EXPORT Standard_Boolean IsInScope(const Standard_Integer num) const;
 
+  //! Sets the flag to format the entities of the DATA Section by several threads.
+  //! The entities are split into ranges, each one is formatted separately, then the
+  //! lines are gathered in the order of the entities, so that the text does not change.
+  //! FALSE by default.
+  void SetParallel(const Standard_Boolean theToParallel) { theparallel = theToParallel; }
+
+  //! Returns the flag to format the entities of the DATA Section by several threads.
+  Standard_Boolean ToParallel() const { return theparallel; }
+
   //! Sends the complete Model, included HEADER and DATA Sections
   //! Works with a WriterLib defined through a Protocol
   //! If <headeronly> is given True, only the HEADER Section is sent
@@ -280,24 +292,50 @@ private:
                                  const Standard_Integer lnstr,
                                  const Standard_Integer more = 0);
 
-  Handle(StepData_StepModel)              themodel;
-  Handle(TColStd_HSequenceOfHAsciiString) thefile;
-  LineBuffer                    thecurr;
-  Standard_Boolean                        thesect;
-  Standard_Boolean                        thecomm;
-  Standard_Boolean                        thefirst;
-  Standard_Boolean                        themult;
-  Standard_Integer                        thelevel;
-  Standard_Boolean                        theindent;
-  Standard_Integer                        theindval;
-  Standard_Integer                        thetypmode;
-  InterfaceFloatWriter                   thefloatw;
-  Interface_CheckIterator                 thechecks;
-  Standard_Integer                        thenum;
-  Standard_Integer                        thelabmode;
-  Handle(TColStd_HArray1OfInteger)        thescopebeg;
-  Handle(TColStd_HArray1OfInteger)        thescopeend;
-  Handle(TColStd_HArray1OfInteger)        thescopenext;
+  //! Sends the Entities of the Data Section with numbers from <theFirst> to <theLast>,
+  //! except the ones sent by the Scopes which contain them
+  Standard_EXPORT void SendEntities(const StepData_WriterLib& theLib,
+                                    const Standard_Integer    theFirst,
+                                    const Standard_Integer    theLast);
+
+  //! Sends the Entities of the Data Section by several threads
+  Standard_EXPORT void SendEntitiesParallel(const StepData_WriterLib& theLib);
+
+  //! Appends the current line to the text, then clears it
+  Standard_EXPORT void FlushLine();
+
+  //! Appends a line to the text
+  Standard_EXPORT void AddLine(const Standard_CString theText, const Standard_Integer theLength);
+
+  //! Line of the text, kept in the memory of one of the allocators of the writer
+  struct TextLine
+  {
+    Standard_CString Text;
+    Standard_Integer Length;
+  };
+
+  Handle(StepData_StepModel)                         themodel;
+  NCollection_Vector<TextLine>                       thefile;
+  Handle(NCollection_IncAllocator)                   thealloc;
+  // memory of the lines formatted by other writers, see SendEntitiesParallel()
+  NCollection_List<Handle(NCollection_IncAllocator)> thestorages;
+  LineBuffer                                         thecurr;
+  Standard_Boolean                                   thesect;
+  Standard_Boolean                                   thecomm;
+  Standard_Boolean                                   thefirst;
+  Standard_Boolean                                   themult;
+  Standard_Integer                                   thelevel;
+  Standard_Boolean                                   theindent;
+  Standard_Integer                                   theindval;
+  Standard_Integer                                   thetypmode;
+  InterfaceFloatWriter                               thefloatw;
+  Interface_CheckIterator                            thechecks;
+  Standard_Integer                                   thenum;
+  Standard_Integer                                   thelabmode;
+  Handle(TColStd_HArray1OfInteger)                   thescopebeg;
+  Handle(TColStd_HArray1OfInteger)                   thescopeend;
+  Handle(TColStd_HArray1OfInteger)                   thescopenext;
+  Standard_Boolean                                   theparallel;
 };
 
 #endif // _StepData_StepWriter_HeaderFile
@@ -18,6 +18,7 @@
 #include <Interface_EntityIterator.hxx>
 #include <Interface_Macros.hxx>
 #include <Interface_ReportEntity.hxx>
+#include <Interface_Static.hxx>
 #include <Message.hxx>
 #include <Message_Messenger.hxx>
 #include <OSD_FileSystem.hxx>
@@ -98,6 +99,7 @@ Standard_Boolean StepSelect_WorkLibrary::WriteFile(IFSelect_ContextWrite& ctx) c
   }
   sout << " Step File Name : " << ctx.FileName();
   StepData_StepWriter SW(stepmodel);
+  SW.SetParallel(ExchangeConfig::IVal("write.step.parallel") == 1);
   sout << "(" << stepmodel->NbEntities() << " ents) ";
 
   //  File Modifiers
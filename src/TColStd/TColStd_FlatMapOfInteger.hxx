@@ -0,0 +1,24 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef TColStd_FlatMapOfInteger_HeaderFile
+#define TColStd_FlatMapOfInteger_HeaderFile
+
+#include <Standard_Integer.hxx>
+#include <NCollection_FlatMap.hxx>
+
+//! Map of integers with flat storage, alternative to TColStd_MapOfInteger.
+typedef NCollection_FlatMap<Standard_Integer>           TColStd_FlatMapOfInteger;
+typedef NCollection_FlatMap<Standard_Integer>::Iterator TColStd_FlatMapIteratorOfFlatMapOfInteger;
+
+#endif
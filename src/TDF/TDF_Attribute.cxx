@@ -325,6 +325,13 @@ Handle(TDF_DeltaOnRemoval) TDF_Attribute::DeltaOnRemoval() const
   return new TDF_DefaultDeltaOnRemoval(this);
 } // myBackup
 
+//=================================================================================================
+
+Standard_Size TDF_Attribute::EstimatedSize() const
+{
+  return DynamicType()->Size();
+}
+
 //=======================================================================
 // function : Dump
 // purpose  : This method is equivalent to operator <<
@@ -344,6 +344,11 @@ public:
   //! If there is none, do not implement the method.
   Standard_EXPORT virtual void References(const Handle(TDF_DataSet)& aDataSet) const;
 
+  //! Returns the estimated number of bytes occupied by the attribute
+  //! including its own data; used for limiting the memory of undo deltas.
+  //! Default implementation returns the size of the attribute object only.
+  Standard_EXPORT virtual Standard_Size EstimatedSize() const;
+
   //! Dumps the minimum information about <me> on
   //! <aStream>.
   Standard_EXPORT virtual Standard_OStream& Dump(Standard_OStream& anOS) const;
@@ -61,6 +61,13 @@ Standard_GUID TDF_AttributeDelta::ID() const
 
 //=================================================================================================
 
+Standard_Size TDF_AttributeDelta::EstimatedSize() const
+{
+  return DynamicType()->Size();
+}
+
+//=================================================================================================
+
 Standard_OStream& TDF_AttributeDelta::Dump(Standard_OStream& OS) const
 {
   static AsciiString1 entry;
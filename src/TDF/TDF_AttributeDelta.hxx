@@ -55,6 +55,11 @@ public:
   //! Returns the ID of the attribute concerned by <me>.
   Standard_EXPORT Standard_GUID ID() const;
 
+  //! Returns the estimated number of bytes kept by <me> for undo.
+  //! Default implementation returns the size of the delta object only,
+  //! as the reference attribute is kept by the document.
+  Standard_EXPORT virtual Standard_Size EstimatedSize() const;
+
   //! Dumps the contents.
   Standard_EXPORT virtual Standard_OStream& Dump(Standard_OStream& OS) const;
 
@@ -99,7 +99,8 @@ Data2::Data2()
       myNotUndoMode(Standard_True),
       myTime(0),
       myAllowModification(Standard_True),
-      myAccessByEntries(Standard_False)
+      myAccessByEntries(Standard_False),
+      myCompactDeltas(Standard_False)
 {
   const Handle(NCollection_IncAllocator) anIncAllocator = new NCollection_IncAllocator(16000);
   myLabelNodeAllocator                                  = anIncAllocator;
@@ -509,4 +510,5 @@ void Data2::DumpJson(Standard_OStream& theOStream, Standard_Integer /*theDepth*/
     OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, aTime)
   }
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myAllowModification)
+  OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myCompactDeltas)
 }
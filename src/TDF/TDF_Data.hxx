@@ -88,6 +88,14 @@ public:
   //! returns modification mode.
   Standard_Boolean IsModificationAllowed() const;
 
+  //! Sets compact deltas mode. When it is on, array-like attributes record
+  //! only the modified values in undo deltas instead of the full backup copies,
+  //! regardless of their own delta flag.
+  void SetCompactDeltas(const Standard_Boolean theToCompact) { myCompactDeltas = theToCompact; }
+
+  //! Returns compact deltas mode; FALSE by default.
+  Standard_Boolean IsCompactDeltas() const { return myCompactDeltas; }
+
   //! Initializes a mechanism for fast access to the labels by their entries.
   //! The fast access is useful for large documents and often access to the labels
   //! via entries. Internally, a table of entry - label is created,
@@ -210,6 +218,7 @@ private:
   TDF_HAllocator                                          myLabelNodeAllocator;
   Standard_Boolean                                        myAllowModification;
   Standard_Boolean                                        myAccessByEntries;
+  Standard_Boolean                                        myCompactDeltas;
   NCollection_DataMap<AsciiString1, DataLabel> myAccessByEntriesTable;
 };
 
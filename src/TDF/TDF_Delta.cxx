@@ -61,6 +61,18 @@ void Delta::AddAttributeDelta(const Handle(TDF_AttributeDelta)& anAttributeDelta
 
 //=================================================================================================
 
+Standard_Size Delta::EstimatedSize() const
+{
+  Standard_Size aSize = DynamicType()->Size();
+  for (TDF_ListIteratorOfAttributeDeltaList anIter(myAttDeltaList); anIter.More(); anIter.Next())
+  {
+    aSize += anIter.Value()->EstimatedSize();
+  }
+  return aSize;
+}
+
+//=================================================================================================
+
 void Delta::BeforeOrAfterApply(const Standard_Boolean before) const
 {
   TDF_AttributeDeltaList ADlist;
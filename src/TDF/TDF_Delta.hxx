@@ -62,6 +62,9 @@ public:
   //! Returns the field <myAttDeltaList>.
   const TDF_AttributeDeltaList& AttributeDeltas() const;
 
+  //! Returns the estimated number of bytes kept by the attribute deltas.
+  Standard_EXPORT Standard_Size EstimatedSize() const;
+
   //! Returns a name associated with this delta.
   UtfString Name() const;
 
@@ -20,6 +20,8 @@
 
 #include <TDF_DeltaOnModification.hxx>
 
+#include <TDF_Attribute.hxx>
+
 IMPLEMENT_STANDARD_RTTIEXT(TDF_DeltaOnModification, TDF_AttributeDelta)
 
 //=================================================================================================
@@ -35,3 +37,10 @@ void TDF_DeltaOnModification::Apply()
 {
   Attribute()->DeltaOnModification(this);
 }
+
+//=================================================================================================
+
+Standard_Size TDF_DeltaOnModification::EstimatedSize() const
+{
+  return TDF_AttributeDelta::EstimatedSize() + Attribute()->EstimatedSize();
+}
@@ -36,6 +36,9 @@ public:
   //! Applies the delta to the attribute.
   Standard_EXPORT virtual void Apply() Standard_OVERRIDE;
 
+  //! Returns the estimated number of bytes including the backup attribute.
+  Standard_EXPORT virtual Standard_Size EstimatedSize() const Standard_OVERRIDE;
+
   DEFINE_STANDARD_RTTIEXT(TDF_DeltaOnModification, TDF_AttributeDelta)
 
 protected:
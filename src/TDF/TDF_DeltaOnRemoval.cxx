@@ -20,6 +20,8 @@
 
 #include <TDF_DeltaOnRemoval.hxx>
 
+#include <TDF_Attribute.hxx>
+
 IMPLEMENT_STANDARD_RTTIEXT(TDF_DeltaOnRemoval, TDF_AttributeDelta)
 
 //=================================================================================================
@@ -28,3 +30,10 @@ TDF_DeltaOnRemoval::TDF_DeltaOnRemoval(const Handle(TDF_Attribute)& anAtt)
     : TDF_AttributeDelta(anAtt)
 {
 }
+
+//=================================================================================================
+
+Standard_Size TDF_DeltaOnRemoval::EstimatedSize() const
+{
+  return TDF_AttributeDelta::EstimatedSize() + Attribute()->EstimatedSize();
+}
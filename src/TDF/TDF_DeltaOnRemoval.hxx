@@ -33,6 +33,9 @@ class TDF_DeltaOnRemoval : public TDF_AttributeDelta
 {
 
 public:
+  //! Returns the estimated number of bytes including the removed attribute.
+  Standard_EXPORT virtual Standard_Size EstimatedSize() const Standard_OVERRIDE;
+
   DEFINE_STANDARD_RTTIEXT(TDF_DeltaOnRemoval, TDF_AttributeDelta)
 
 protected:
@@ -25,6 +25,13 @@
 #include <TDF_LabelNodePtr.hxx>
 #include <TDF_Tool.hxx>
 
+namespace
+{
+//! Number of children skipped while looking for a child,
+//! after which the children of the label are indexed by tags.
+static const Standard_Integer THE_NB_CHILDREN_TO_INDEX = 64;
+} // namespace
+
 // Attribute methods ++++++++++++++++++++++++++++++++++++++++++++++++++++
 //=======================================================================
 // function : Imported
@@ -290,11 +297,28 @@ TDF_LabelNode* DataLabel::FindOrAddChild(const Standard_Integer aTag,
   TDF_LabelNode* lastFoundLnp   = myLabelNode->myLastFoundChild; // jfa 10.01.2003
   TDF_LabelNode* childLabelNode = NULL;
 
+  // Labels with many children have them indexed by tags.
+  TDF_LabelNode::ChildIndex* anIndex = myLabelNode->ChildrenIndex();
+  if (anIndex != NULL)
+  {
+    TDF_LabelNode* const* aFoundLnp = anIndex->Children.Seek(aTag);
+    if (aFoundLnp != NULL)
+      return *aFoundLnp;
+    if (!create)
+      return NULL;
+  }
+
   // Finds the right place.
 
+  if (anIndex != NULL && anIndex->LastChild->Tag() < aTag)
+  {
+    // The most usual case of appending a new child.
+    lastLnp    = anIndex->LastChild;
+    currentLnp = NULL;
+  }
   // jfa 10.01.2003
   //  1. Check, if we access to a child, which is after last touched upon
-  if (lastFoundLnp != NULL)
+  else if (lastFoundLnp != NULL)
   {
     if (lastFoundLnp->Tag() == aTag)
     {
@@ -309,10 +333,12 @@ TDF_LabelNode* DataLabel::FindOrAddChild(const Standard_Integer aTag,
   // jfa 10.01.2003 end
 
   // To facilitate many tools, label brethren are stored in increasing order.
+  Standard_Integer aNbSkipped = 0;
   while ((currentLnp != NULL) && (currentLnp->Tag() < aTag))
   {
     lastLnp    = currentLnp;
     currentLnp = currentLnp->Brother();
+    ++aNbSkipped;
   }
 
   if ((currentLnp != NULL) && (currentLnp->Tag() == aTag))
@@ -332,11 +358,16 @@ TDF_LabelNode* DataLabel::FindOrAddChild(const Standard_Integer aTag,
       myLabelNode->myFirstChild = childLabelNode;
     else // ... somewhere.
       lastLnp->myBrother = childLabelNode;
+    myLabelNode->AddToChildrenIndex(childLabelNode);
     // Update table for fast access to the labels.
     if (myLabelNode->Data()->IsAccessByEntries())
       myLabelNode->Data()->RegisterLabel(childLabelNode);
   }
 
+  // Avoid walking along long lists of children next time.
+  if (anIndex == NULL && aNbSkipped > THE_NB_CHILDREN_TO_INDEX)
+    myLabelNode->IndexChildren();
+
   if (lastLnp)                               // agv 14.07.2010
     myLabelNode->myLastFoundChild = lastLnp; // jfa 10.01.2003
 
@@ -32,6 +32,7 @@ TDF_LabelNode::TDF_LabelNode(Data2* aDataPtr)
 #endif
       myFirstChild(NULL),
       myLastFoundChild(NULL), // jfa 10.01.2003
+      myChildIndex(NULL),
       myTag(0),               // Always 0 for root.
       myFlags(0),
 #ifdef KEEP_LOCAL_ROOT
@@ -50,6 +51,7 @@ TDF_LabelNode::TDF_LabelNode(const Standard_Integer aTag, TDF_LabelNode* aFather
       myBrother(NULL),
       myFirstChild(NULL),
       myLastFoundChild(NULL), // jfa 10.01.2003
+      myChildIndex(NULL),
       myTag(aTag),
       myFlags(0),
 #ifdef KEEP_LOCAL_ROOT
@@ -82,8 +84,10 @@ void TDF_LabelNode::Destroy(const TDF_HAllocator& theAllocator)
     myFirstChild->Destroy(theAllocator);
     myFirstChild = aSecondChild;
   }
+  delete (ChildIndex*)myChildIndex;
   this->~TDF_LabelNode();
   myFather = myBrother = myFirstChild = myLastFoundChild = NULL;
+  myChildIndex = NULL;
   myTag = myFlags = 0;
 
   // deallocate memory (does nothing for IncAllocator)
@@ -134,6 +138,51 @@ void TDF_LabelNode::RemoveAttribute(const Handle(TDF_Attribute)& afterAtt,
   // oldAtt->myNext.Nullify();
 }
 
+//=======================================================================
+// function : IndexChildren
+// purpose  : Creates the map of children by tags. Can be called by several
+//            threads looking for children concurrently: only one index is kept.
+//=======================================================================
+
+TDF_LabelNode::ChildIndex* TDF_LabelNode::IndexChildren()
+{
+  ChildIndex* anIndex = myChildIndex;
+  if (anIndex != NULL)
+    return anIndex;
+
+  anIndex            = new ChildIndex();
+  anIndex->LastChild = NULL;
+  for (TDF_LabelNode* aChild = myFirstChild; aChild != NULL; aChild = aChild->myBrother)
+  {
+    anIndex->Children.Bind(aChild->myTag, aChild);
+    anIndex->LastChild = aChild;
+  }
+#ifdef Standard_HASATOMIC
+  ChildIndex* anExpected = NULL;
+  if (!myChildIndex.compare_exchange_strong(anExpected, anIndex))
+  {
+    delete anIndex;
+    return anExpected;
+  }
+#else
+  myChildIndex = anIndex;
+#endif
+  return anIndex;
+}
+
+//=================================================================================================
+
+void TDF_LabelNode::AddToChildrenIndex(TDF_LabelNode* theChild)
+{
+  ChildIndex* anIndex = myChildIndex;
+  if (anIndex == NULL)
+    return;
+
+  anIndex->Children.Bind(theChild->myTag, theChild);
+  if (theChild->myBrother == NULL)
+    anIndex->LastChild = theChild;
+}
+
 //=======================================================================
 // function : RootNode
 // purpose  : used for non const object.
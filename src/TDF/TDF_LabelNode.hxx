@@ -20,6 +20,7 @@
 #include <TDF_Attribute.hxx>
 #include <TDF_LabelNodePtr.hxx>
 #include <TDF_HAllocator.hxx>
+#include <NCollection_DataMap.hxx>
 #include <NCollection_DefineAlloc.hxx>
 
 #ifdef Standard_HASATOMIC
@@ -108,6 +109,15 @@ private:
   // Destructor and deallocator
   void Destroy(const TDF_HAllocator& theAllocator);
 
+  //! Index of children by tags, created for labels with many children.
+  struct ChildIndex
+  {
+    DEFINE_STANDARD_ALLOC
+
+    NCollection_DataMap<Standard_Integer, TDF_LabelNode*> Children;
+    TDF_LabelNode*                                        LastChild;
+  };
+
   // Public Friends
   // --------------------------------------------------------------------------
 
@@ -128,6 +138,15 @@ private:
 
   TDF_LabelNode* RootNode();
 
+  // Child index access, NULL while the label has few children
+  inline ChildIndex* ChildrenIndex() const { return myChildIndex; }
+
+  // Creates the index of children (if not yet done)
+  ChildIndex* IndexChildren();
+
+  // Registers a new child within the index (if any)
+  void AddToChildrenIndex(TDF_LabelNode* theChild);
+
   const TDF_LabelNode* RootNode() const;
 
   Standard_EXPORT void AllMayBeModified();
@@ -156,6 +175,7 @@ private:
   TDF_LabelNodePtr myBrother;
   TDF_LabelNodePtr myFirstChild;
   Standard_ATOMIC(TDF_LabelNodePtr) myLastFoundChild; // jfa 10.01.2003
+  Standard_ATOMIC(ChildIndex*) myChildIndex;
   Standard_Integer      myTag;
   Standard_Integer      myFlags; // Flags & Depth
   Handle(TDF_Attribute) myFirstAttribute;
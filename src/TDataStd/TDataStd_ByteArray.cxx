@@ -20,6 +20,7 @@
 #include <Standard_Type.hxx>
 #include <TDataStd_DeltaOnModificationOfByteArray.hxx>
 #include <TDF_Attribute.hxx>
+#include <TDF_Data.hxx>
 #include <TDF_DefaultDeltaOnModification.hxx>
 #include <TDF_DeltaOnModification.hxx>
 #include <TDF_Label.hxx>
@@ -277,10 +278,22 @@ Standard_OStream& TDataStd_ByteArray::Dump(Standard_OStream& anOS) const
 
 //=================================================================================================
 
+Standard_Size TDataStd_ByteArray::EstimatedSize() const
+{
+  Standard_Size aSize = TDF_Attribute::EstimatedSize();
+  if (!myValue.IsNull())
+  {
+    aSize += sizeof(TColStd_HArray1OfByte) + myValue->Length() * sizeof(Standard_Byte);
+  }
+  return aSize;
+}
+
+//=================================================================================================
+
 Handle(TDF_DeltaOnModification) TDataStd_ByteArray::DeltaOnModification(
   const Handle(TDF_Attribute)& OldAttribute) const
 {
-  if (myIsDelta)
+  if (myIsDelta || Label().Data()->IsCompactDeltas())
     return new TDataStd_DeltaOnModificationOfByteArray(
       Handle(TDataStd_ByteArray)::DownCast(OldAttribute));
   else
@@ -119,6 +119,9 @@ public:
 
   Standard_EXPORT virtual Standard_OStream& Dump(Standard_OStream& OS) const Standard_OVERRIDE;
 
+  //! Returns the estimated number of bytes including the array values.
+  Standard_EXPORT virtual Standard_Size EstimatedSize() const Standard_OVERRIDE;
+
   //! Makes a DeltaOnModification between <me> and
   //! <anOldAttribute>.
   Standard_EXPORT virtual Handle(TDF_DeltaOnModification) DeltaOnModification(
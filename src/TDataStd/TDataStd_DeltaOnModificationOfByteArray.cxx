@@ -191,3 +191,16 @@ void TDataStd_DeltaOnModificationOfByteArray::Apply()
   std::cout << std::endl;
 #endif
 }
+
+//=================================================================================================
+
+Standard_Size TDataStd_DeltaOnModificationOfByteArray::EstimatedSize() const
+{
+  Standard_Size aSize = TDF_DeltaOnModification::EstimatedSize();
+  if (!myIndxes.IsNull())
+  {
+    aSize += sizeof(TColStd_HArray1OfInteger) + sizeof(TColStd_HArray1OfByte)
+             + myIndxes->Length() * (sizeof(Standard_Integer) + sizeof(Standard_Byte));
+  }
+  return aSize;
+}
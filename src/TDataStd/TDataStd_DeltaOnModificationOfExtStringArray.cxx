@@ -193,3 +193,25 @@ void TDataStd_DeltaOnModificationOfExtStringArray::Apply()
   std::cout << std::endl;
 #endif
 }
+
+//=================================================================================================
+
+Standard_Size TDataStd_DeltaOnModificationOfExtStringArray::EstimatedSize() const
+{
+  Standard_Size aSize = TDF_DeltaOnModification::EstimatedSize();
+  if (!myIndxes.IsNull())
+  {
+    aSize += sizeof(TColStd_HArray1OfInteger) + myIndxes->Length() * sizeof(Standard_Integer);
+  }
+  if (!myValues.IsNull())
+  {
+    aSize += sizeof(TColStd_HArray1OfExtendedString);
+    for (TColStd_Array1OfExtendedString::Iterator aValIter(myValues->Array1()); aValIter.More();
+         aValIter.Next())
+    {
+      aSize += sizeof(UtfString)
+               + (aValIter.Value().Length() + 1) * sizeof(Standard_ExtCharacter);
+    }
+  }
+  return aSize;
+}
@@ -40,6 +40,9 @@ public:
   //! Applies the delta to the attribute.
   Standard_EXPORT virtual void Apply() Standard_OVERRIDE;
 
+  //! Returns the estimated number of bytes including the modified values.
+  Standard_EXPORT virtual Standard_Size EstimatedSize() const Standard_OVERRIDE;
+
   DEFINE_STANDARD_RTTIEXT(TDataStd_DeltaOnModificationOfExtStringArray, TDF_DeltaOnModification)
 
 protected:
@@ -189,3 +189,15 @@ void TDataStd_DeltaOnModificationOfIntArray::Apply()
   std::cout << std::endl;
 #endif
 }
+
+//=================================================================================================
+
+Standard_Size TDataStd_DeltaOnModificationOfIntArray::EstimatedSize() const
+{
+  Standard_Size aSize = TDF_DeltaOnModification::EstimatedSize();
+  if (!myIndxes.IsNull())
+  {
+    aSize += 2 * (sizeof(TColStd_HArray1OfInteger) + myIndxes->Length() * sizeof(Standard_Integer));
+  }
+  return aSize;
+}
@@ -136,3 +136,21 @@ void TDataStd_DeltaOnModificationOfIntPackedMap::Apply()
   std::cout << std::endl;
 #endif
 }
+
+//=================================================================================================
+
+Standard_Size TDataStd_DeltaOnModificationOfIntPackedMap::EstimatedSize() const
+{
+  Standard_Size aSize = TDF_DeltaOnModification::EstimatedSize();
+  if (!myAddition.IsNull())
+  {
+    aSize += sizeof(TColStd_HPackedMapOfInteger)
+             + myAddition->Map().Extent() * sizeof(Standard_Integer);
+  }
+  if (!myDeletion.IsNull())
+  {
+    aSize += sizeof(TColStd_HPackedMapOfInteger)
+             + myDeletion->Map().Extent() * sizeof(Standard_Integer);
+  }
+  return aSize;
+}
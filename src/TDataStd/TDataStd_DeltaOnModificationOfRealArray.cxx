@@ -187,3 +187,16 @@ void TDataStd_DeltaOnModificationOfRealArray::Apply()
   std::cout << std::endl;
 #endif
 }
+
+//=================================================================================================
+
+Standard_Size TDataStd_DeltaOnModificationOfRealArray::EstimatedSize() const
+{
+  Standard_Size aSize = TDF_DeltaOnModification::EstimatedSize();
+  if (!myIndxes.IsNull())
+  {
+    aSize += sizeof(TColStd_HArray1OfInteger) + sizeof(TColStd_HArray1OfReal)
+             + myIndxes->Length() * (sizeof(Standard_Integer) + sizeof(Standard_Real));
+  }
+  return aSize;
+}
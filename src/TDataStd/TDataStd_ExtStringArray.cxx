@@ -21,6 +21,7 @@
 #include <TCollection_ExtendedString.hxx>
 #include <TDataStd_DeltaOnModificationOfExtStringArray.hxx>
 #include <TDF_Attribute.hxx>
+#include <TDF_Data.hxx>
 #include <TDF_DefaultDeltaOnModification.hxx>
 #include <TDF_DeltaOnModification.hxx>
 #include <TDF_Label.hxx>
@@ -297,10 +298,28 @@ Standard_OStream& TDataStd_ExtStringArray::Dump(Standard_OStream& anOS) const
 
 //=================================================================================================
 
+Standard_Size TDataStd_ExtStringArray::EstimatedSize() const
+{
+  Standard_Size aSize = TDF_Attribute::EstimatedSize();
+  if (!myValue.IsNull())
+  {
+    aSize += sizeof(TColStd_HArray1OfExtendedString);
+    for (TColStd_Array1OfExtendedString::Iterator aValIter(myValue->Array1()); aValIter.More();
+         aValIter.Next())
+    {
+      aSize += sizeof(UtfString)
+               + (aValIter.Value().Length() + 1) * sizeof(Standard_ExtCharacter);
+    }
+  }
+  return aSize;
+}
+
+//=================================================================================================
+
 Handle(TDF_DeltaOnModification) TDataStd_ExtStringArray::DeltaOnModification(
   const Handle(TDF_Attribute)& OldAttribute) const
 {
-  if (myIsDelta)
+  if (myIsDelta || Label().Data()->IsCompactDeltas())
     return new TDataStd_DeltaOnModificationOfExtStringArray(
       Handle(TDataStd_ExtStringArray)::DownCast(OldAttribute));
   else
@@ -22,6 +22,7 @@
 #include <TColStd_PackedMapOfInteger.hxx>
 #include <TDataStd_DeltaOnModificationOfIntPackedMap.hxx>
 #include <TDF_Attribute.hxx>
+#include <TDF_Data.hxx>
 #include <TDF_DefaultDeltaOnModification.hxx>
 #include <TDF_DeltaOnModification.hxx>
 #include <TDF_Label.hxx>
@@ -193,10 +194,22 @@ Standard_OStream& TDataStd_IntPackedMap::Dump(Standard_OStream& theOS) const
 
 //=================================================================================================
 
+Standard_Size TDataStd_IntPackedMap::EstimatedSize() const
+{
+  Standard_Size aSize = TDF_Attribute::EstimatedSize();
+  if (!myMap.IsNull())
+  {
+    aSize += sizeof(TColStd_HPackedMapOfInteger) + myMap->Map().Extent() * sizeof(Standard_Integer);
+  }
+  return aSize;
+}
+
+//=================================================================================================
+
 Handle(TDF_DeltaOnModification) TDataStd_IntPackedMap::DeltaOnModification(
   const Handle(TDF_Attribute)& OldAttribute) const
 {
-  if (myIsDelta)
+  if (myIsDelta || Label().Data()->IsCompactDeltas())
     return new TDataStd_DeltaOnModificationOfIntPackedMap(
       Handle(TDataStd_IntPackedMap)::DownCast(OldAttribute));
   else
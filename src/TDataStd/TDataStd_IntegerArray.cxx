@@ -21,6 +21,7 @@
 #include <Standard_Type.hxx>
 #include <TDataStd_DeltaOnModificationOfIntArray.hxx>
 #include <TDF_Attribute.hxx>
+#include <TDF_Data.hxx>
 #include <TDF_DefaultDeltaOnModification.hxx>
 #include <TDF_DeltaOnModification.hxx>
 #include <TDF_Label.hxx>
@@ -302,10 +303,22 @@ Standard_OStream& TDataStd_IntegerArray::Dump(Standard_OStream& anOS) const
 
 //=================================================================================================
 
+Standard_Size TDataStd_IntegerArray::EstimatedSize() const
+{
+  Standard_Size aSize = TDF_Attribute::EstimatedSize();
+  if (!myValue.IsNull())
+  {
+    aSize += sizeof(TColStd_HArray1OfInteger) + myValue->Length() * sizeof(Standard_Integer);
+  }
+  return aSize;
+}
+
+//=================================================================================================
+
 Handle(TDF_DeltaOnModification) TDataStd_IntegerArray::DeltaOnModification(
   const Handle(TDF_Attribute)& OldAttribute) const
 {
-  if (myIsDelta)
+  if (myIsDelta || Label().Data()->IsCompactDeltas())
     return new TDataStd_DeltaOnModificationOfIntArray(
       Handle(TDataStd_IntegerArray)::DownCast(OldAttribute));
   else
@@ -21,6 +21,7 @@
 #include <Standard_Type.hxx>
 #include <TDataStd_DeltaOnModificationOfRealArray.hxx>
 #include <TDF_Attribute.hxx>
+#include <TDF_Data.hxx>
 #include <TDF_DefaultDeltaOnModification.hxx>
 #include <TDF_DeltaOnModification.hxx>
 #include <TDF_Label.hxx>
@@ -296,10 +297,22 @@ Standard_OStream& TDataStd_RealArray::Dump(Standard_OStream& anOS) const
 
 //=================================================================================================
 
+Standard_Size TDataStd_RealArray::EstimatedSize() const
+{
+  Standard_Size aSize = TDF_Attribute::EstimatedSize();
+  if (!myValue.IsNull())
+  {
+    aSize += sizeof(TColStd_HArray1OfReal) + myValue->Length() * sizeof(Standard_Real);
+  }
+  return aSize;
+}
+
+//=================================================================================================
+
 Handle(TDF_DeltaOnModification) TDataStd_RealArray::DeltaOnModification(
   const Handle(TDF_Attribute)& OldAtt) const
 {
-  if (myIsDelta)
+  if (myIsDelta || Label().Data()->IsCompactDeltas())
     return new TDataStd_DeltaOnModificationOfRealArray(
       Handle(TDataStd_RealArray)::DownCast(OldAtt));
   else
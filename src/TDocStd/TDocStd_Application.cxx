@@ -18,6 +18,7 @@
 
 #include <CDF_Directory.hxx>
 #include <CDF_DirectoryIterator.hxx>
+#include <CDF_DriverSentry.hxx>
 #include <CDF_Store.hxx>
 #include <PCDM_RetrievalDriver.hxx>
 #include <PCDM_StorageDriver.hxx>
@@ -57,6 +58,7 @@ Standard_Boolean AppManager::IsDriverLoaded() const
 
 Handle(Resource_Manager) AppManager::Resources()
 {
+  Standard_Mutex::Sentry aLock(Mutex());
   if (myResources.IsNull())
   {
     myResources = new Resource_Manager(ResourcesName());
@@ -246,6 +248,9 @@ PCDM_ReaderStatus AppManager::Open(const UtfString& path,
   UtfString file      = tool.Name();
   file += ".";
   file += tool.Extension();
+  // the file is reserved until the end of the retrieval, so that another thread
+  // opening the same file gets the status of the document already retrieved
+  RetrievalSentry aFileSentry(*this, directory, file);
   status = CanRetrieve(directory, file, !theFilter.IsNull() && theFilter->IsAppendMode());
 
   if (status != PCDM_RS_OK)
@@ -256,8 +261,9 @@ PCDM_ReaderStatus AppManager::Open(const UtfString& path,
   try
   {
     OCC_CATCH_SIGNALS
+    // the status of this call is returned, not affected by concurrent retrievals
     Handle(AppDocument) D = Handle(AppDocument)::DownCast(
-      Retrieve(directory, file, Standard_True, theFilter, theRange));
+      Retrieve(directory, file, UtfString(), status, Standard_True, theFilter, theRange));
     if (theFilter.IsNull() || !theFilter->IsAppendMode())
       CDF_Application::Open(D);
     theDoc = D;
@@ -274,7 +280,7 @@ PCDM_ReaderStatus AppManager::Open(const UtfString& path,
       MessageDriver()->Send(aString.ToExtString(), Message_Fail);
     }
   }
-  status = GetRetrieveStatus();
+  SetRetrieveStatus(status);
 #ifdef OCCT_DEBUG
   std::cout << "AppManager::Open(): The status = " << status << std::endl;
 #endif
@@ -288,11 +294,12 @@ PCDM_ReaderStatus AppManager::Open(Standard_IStream&                theIStream,
                                             const Handle(ReaderFilter)& theFilter,
                                             const Message_ProgressRange&     theRange)
 {
+  PCDM_ReaderStatus aStatus = PCDM_RS_DriverFailure;
   try
   {
     OCC_CATCH_SIGNALS
     Handle(CDM_Document) aCDMDoc = theDoc;
-    Read(theIStream, aCDMDoc, theFilter, theRange);
+    Read(theIStream, aCDMDoc, aStatus, theFilter, theRange);
     // Read calls NewDocument of AppManager, so, it should the AppDocument in the
     // result anyway
     theDoc = Handle(AppDocument)::DownCast(aCDMDoc);
@@ -311,7 +318,8 @@ PCDM_ReaderStatus AppManager::Open(Standard_IStream&                theIStream,
       MessageDriver()->Send(aFailureMessage.ToExtString(), Message_Fail);
     }
   }
-  return GetRetrieveStatus();
+  SetRetrieveStatus(aStatus);
+  return aStatus;
 }
 
 //=================================================================================================
@@ -375,6 +383,10 @@ PCDM_StoreStatus AppManager::SaveAs(const Handle(AppDocument)& theDoc,
       return PCDM_SS_DriverFailure;
     }
 
+    // use the shared driver, or its copy if the driver is busy with another document
+    CDF_DriverSentry<PCDM_StorageDriver> aDriverSentry(aDocStorageDriver);
+    aDocStorageDriver = aDriverSentry.Driver();
+
     aDocStorageDriver->SetFormat(theDoc->StorageFormat());
     aDocStorageDriver->Write(theDoc, theOStream, theRange);
 
@@ -500,6 +512,10 @@ PCDM_StoreStatus AppManager::SaveAs(const Handle(AppDocument)& theDoc,
       return PCDM_SS_DriverFailure;
     }
 
+    // use the shared driver, or its copy if the driver is busy with another document
+    CDF_DriverSentry<PCDM_StorageDriver> aDriverSentry(aDocStorageDriver);
+    aDocStorageDriver = aDriverSentry.Driver();
+
     aDocStorageDriver->SetFormat(theDoc->StorageFormat());
     aDocStorageDriver->Write(theDoc, theOStream, theRange);
 
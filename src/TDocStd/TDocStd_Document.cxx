@@ -72,6 +72,8 @@ AppDocument::AppDocument(const UtfString& aStorageFormat)
     : myStorageFormat(aStorageFormat),
       myData(new Data2()),
       myUndoLimit(0),
+      myUndoMemoryLimit(0),
+      myUndosSize(0),
       myUndoTransaction("UNDO"),
       mySaveTime(0),
       myIsNestedTransactionMode(0),
@@ -271,8 +273,10 @@ Standard_Boolean AppDocument::CommitTransaction()
       if (!D->IsEmpty())
       {
         myUndos.Append(D);
+        addUndoSize(D);
         myRedos.Clear(); // if we push an Undo we clear the redos
         isDone = Standard_True;
+        limitUndosMemory();
       }
     }
 
@@ -297,12 +301,14 @@ Standard_Boolean AppDocument::CommitTransaction()
 
         myRedos.Clear();   // if we push an Undo we clear the redos
         myUndos.Append(D); // New undos are at the end of the list
+        addUndoSize(D);
         // Check  the limit to remove the oldest one
         if (myUndos.Extent() > myUndoLimit)
         {
 #ifdef SRN_DELTA_COMPACT
           Handle(Delta) aDelta = myUndos.First();
 #endif
+          removeUndoSize(myUndos.First());
           myUndos.RemoveFirst();
 #ifdef SRN_DELTA_COMPACT
           if (myFromUndo == aDelta)
@@ -318,6 +324,7 @@ Standard_Boolean AppDocument::CommitTransaction()
           }
 #endif
         }
+        limitUndosMemory();
       }
     }
 
@@ -437,6 +444,7 @@ void AppDocument::SetUndoLimit(const Standard_Integer L)
   Standard_Integer n = myUndos.Extent() - myUndoLimit;
   while (n > 0)
   {
+    removeUndoSize(myUndos.First());
     myUndos.RemoveFirst();
     --n;
   }
@@ -451,6 +459,94 @@ void AppDocument::SetUndoLimit(const Standard_Integer L)
 
 //=================================================================================================
 
+void AppDocument::SetUndoMemoryLimit(const Standard_Size theNbBytes)
+{
+  if (theNbBytes == 0)
+  {
+    myUndoSizes.Clear();
+    myUndosSize = 0;
+  }
+  else if (myUndoMemoryLimit == 0)
+  {
+    // the memory of Undos is accounted only while the limit is set
+    myUndoMemoryLimit = theNbBytes;
+    for (TDF_DeltaList::Iterator anUndoIt(myUndos); anUndoIt.More(); anUndoIt.Next())
+    {
+      addUndoSize(anUndoIt.Value());
+    }
+  }
+  myUndoMemoryLimit = theNbBytes;
+  limitUndosMemory();
+}
+
+//=================================================================================================
+
+Standard_Size AppDocument::UndosEstimatedSize() const
+{
+  if (myUndoMemoryLimit != 0)
+  {
+    return myUndosSize;
+  }
+
+  Standard_Size aSize = 0;
+  for (TDF_DeltaList::Iterator anUndoIt(myUndos); anUndoIt.More(); anUndoIt.Next())
+  {
+    aSize += anUndoIt.Value()->EstimatedSize();
+  }
+  return aSize;
+}
+
+//=================================================================================================
+
+void AppDocument::addUndoSize(const Handle(Delta)& theDelta)
+{
+  if (myUndoMemoryLimit == 0)
+  {
+    return;
+  }
+
+  const Standard_Size aSize = theDelta->EstimatedSize();
+  if (myUndoSizes.Bind(theDelta, aSize))
+  {
+    myUndosSize += aSize;
+  }
+}
+
+//=================================================================================================
+
+void AppDocument::removeUndoSize(const Handle(Delta)& theDelta)
+{
+  if (const Standard_Size* aSize = myUndoSizes.Seek(theDelta))
+  {
+    myUndosSize -= *aSize;
+    myUndoSizes.UnBind(theDelta);
+  }
+}
+
+//=================================================================================================
+
+void AppDocument::limitUndosMemory()
+{
+  if (myUndoMemoryLimit == 0 || myUndosSize <= myUndoMemoryLimit || myUndos.Extent() < 2)
+  {
+    return;
+  }
+
+#ifdef SRN_DELTA_COMPACT
+  myFromUndo.Nullify(); // Compaction has to aborted, as by SetUndoLimit()
+  myFromRedo.Nullify();
+#endif
+
+  // the last Undo is kept regardless of its size
+  while (myUndosSize > myUndoMemoryLimit && myUndos.Extent() > 1)
+  {
+    removeUndoSize(myUndos.First());
+    myUndos.RemoveFirst();
+  }
+}
+
+//=================================================================================================
+
 Standard_Integer AppDocument::GetUndoLimit() const
 {
   return myUndoLimit;
@@ -468,6 +564,8 @@ Standard_Integer AppDocument::GetAvailableUndos() const
 void AppDocument::ClearUndos()
 {
   myUndos.Clear();
+  myUndoSizes.Clear();
+  myUndosSize = 0;
   myRedos.Clear();
 #ifdef SRN_DELTA_COMPACT
   myFromRedo.Nullify();
@@ -531,6 +629,7 @@ Standard_Boolean AppDocument::Undo()
     // Push the redo
     myRedos.Prepend(D);
     // Remove the last Undo
+    removeUndoSize(myUndos.Last());
     TDocStd_List_RemoveLast(myUndos);
     undoDone = Standard_True;
   }
@@ -588,6 +687,8 @@ Standard_Boolean AppDocument::Redo()
 #endif
     // Push the redo of the redo as an undo (got it !)
     myUndos.Append(D);
+    addUndoSize(D);
+    limitUndosMemory();
     // remove the Redo from the head
     myRedos.RemoveFirst();
     undoDone = Standard_True;
@@ -690,6 +791,7 @@ Standard_Boolean AppDocument::PerformDeltaCompaction()
       aList.Append(anIterator.Value()); // Fill the list of deltas that precede compound delta
       continue;
     }
+    removeUndoSize(anIterator.Value());
 
     if (!isTimeSet)
     { // Set begin and end time when the compound delta is valid
@@ -717,6 +819,7 @@ Standard_Boolean AppDocument::PerformDeltaCompaction()
   myUndos.Clear();
   myUndos.Assign(aList);
   myUndos.Append(aCompoundDelta);
+  addUndoSize(aCompoundDelta);
 
   // Process Redos
 
@@ -823,6 +926,7 @@ void AppDocument::RemoveFirstUndo()
 {
   if (myUndos.IsEmpty())
     return;
+  removeUndoSize(myUndos.First());
   myUndos.RemoveFirst();
 }
 
@@ -893,6 +997,7 @@ void AppDocument::DumpJson(Standard_OStream& theOStream, Standard_Integer theDep
 
   OCCT_DUMP_FIELD_VALUES_DUMPED(theOStream, theDepth, myData.get())
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myUndoLimit)
+  OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myUndoMemoryLimit)
   OCCT_DUMP_FIELD_VALUES_DUMPED(theOStream, theDepth, &myUndoTransaction)
   OCCT_DUMP_FIELD_VALUES_DUMPED(theOStream, theDepth, myFromUndo.get())
   OCCT_DUMP_FIELD_VALUES_DUMPED(theOStream, theDepth, myFromRedo.get())
@@ -22,6 +22,7 @@
 #include <Standard_Integer.hxx>
 #include <TDF_Transaction.hxx>
 #include <TDF_DeltaList.hxx>
+#include <NCollection_DataMap.hxx>
 #include <CDM_Document.hxx>
 #include <TDF_LabelMap.hxx>
 #include <TDocStd_FormatVersion.hxx>
@@ -145,6 +146,20 @@ public:
   //! NewCommand. Of course this limit is the same for Redo
   Standard_EXPORT void SetUndoLimit(const Standard_Integer L);
 
+  //! Returns the limit on the estimated memory of stored Undo deltas in bytes; 0 means no limit.
+  Standard_Size UndoMemoryLimit() const { return myUndoMemoryLimit; }
+
+  //! Sets the limit on the estimated memory of stored Undo deltas in bytes.
+  //! The oldest Undos are removed when the limit is exceeded, but the last Undo is always kept.
+  //! 0 means no limit (default). Memory is estimated by Delta::EstimatedSize() once
+  //! per delta when it is stored. Removal of Undos aborts the delta compaction
+  //! (see InitDeltaCompaction()) as SetUndoLimit() does.
+  //! Use Data2::SetCompactDeltas() to reduce the memory of deltas of array attributes.
+  Standard_EXPORT void SetUndoMemoryLimit(const Standard_Size theNbBytes);
+
+  //! Returns the estimated memory of stored Undo deltas in bytes.
+  Standard_EXPORT Standard_Size UndosEstimatedSize() const;
+
   //! Remove all stored Undos and Redos
   Standard_EXPORT void ClearUndos();
 
@@ -278,8 +293,21 @@ private:
   Standard_EXPORT static void AppendDeltaToTheFirst(const Handle(TDocStd_CompoundDelta)& theDelta1,
                                                     const Handle(Delta)&             theDelta2);
 
+  //! Removes the oldest Undos exceeding the memory limit.
+  //! Delta compaction is aborted if any Undo is removed.
+  void limitUndosMemory();
+
+  //! Estimates memory of the delta appended to the Undos, if the memory limit is set.
+  void addUndoSize(const Handle(Delta)& theDelta);
+
+  //! Subtracts the estimated memory of the delta removed from the Undos.
+  void removeUndoSize(const Handle(Delta)& theDelta);
+
   Handle(Data2)      myData;
   Standard_Integer      myUndoLimit;
+  Standard_Size         myUndoMemoryLimit;
+  Standard_Size         myUndosSize; //!< estimated memory of Undos while the limit is set
+  NCollection_DataMap<Handle(Delta), Standard_Size> myUndoSizes; //!< memory of each Undo
   TDF_Transaction       myUndoTransaction;
   Handle(Delta)     myFromUndo;
   Handle(Delta)     myFromRedo;
@@ -80,13 +80,17 @@ enum TDocStd_FormatVersion
                                     //!< * BIN: New binary format for fast reading of part of OCAF
                                     //!< document [#0031918]
 
+  TDocStd_FormatVersion_VERSION_13, //!< * BIN: Optional storage of document data by compressed
+                                    //!< chunks with an index for parallel and partial reading;
+                                    //!< written only on explicit request of this version
+
   TDocStd_FormatVersion_CURRENT = TDocStd_FormatVersion_VERSION_12 //!< Current version
 };
 
 enum
 {
   TDocStd_FormatVersion_LOWER = TDocStd_FormatVersion_VERSION_2,
-  TDocStd_FormatVersion_UPPER = TDocStd_FormatVersion_VERSION_12
+  TDocStd_FormatVersion_UPPER = TDocStd_FormatVersion_VERSION_13
 };
 
 #endif // _TDocStdFormatVersion_HeaderFile
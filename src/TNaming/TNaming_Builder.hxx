@@ -20,7 +20,10 @@
 #include <Standard.hxx>
 #include <Standard_DefineAlloc.hxx>
 #include <Standard_Handle.hxx>
+#include <TNaming_Evolution.hxx>
+#include <TopAbs_ShapeEnum.hxx>
 
+class ShapeHistory;
 class TNaming_UsedShapes;
 class ShapeAttribute;
 class Standard_ConstructionError;
@@ -70,11 +73,37 @@ public:
   //! of shapes under a label.
   Standard_EXPORT void Select(const TopoShape& aShape, const TopoShape& inShape);
 
+  //! Records at once the modifications of all sub-shapes of the type theType of theShape
+  //! kept in theHistory, as Modify() called for each sub-shape and its modified shapes.
+  //! The map of used shapes is reserved for all pairs before recording them,
+  //! so loading the history of a large Boolean result costs much less than separate calls.
+  Standard_EXPORT void Modify(const Handle(ShapeHistory)& theHistory,
+                              const TopoShape&            theShape,
+                              const TopAbs_ShapeEnum      theType);
+
+  //! Records at once the shapes generated from all sub-shapes of the type theType of
+  //! theShape kept in theHistory, as Generated() called for each pair of shapes.
+  Standard_EXPORT void Generated(const Handle(ShapeHistory)& theHistory,
+                                 const TopoShape&            theShape,
+                                 const TopAbs_ShapeEnum      theType);
+
+  //! Records at once the sub-shapes of the type theType of theShape removed
+  //! according to theHistory, as Delete() called for each of them.
+  Standard_EXPORT void Delete(const Handle(ShapeHistory)& theHistory,
+                              const TopoShape&            theShape,
+                              const TopAbs_ShapeEnum      theType);
+
   //! Returns the NamedShape1 which has been built or is under construction.
   Standard_EXPORT Handle(ShapeAttribute) NamedShape1() const;
 
 protected:
 private:
+  //! Records the history of sub-shapes of theShape with the given evolution.
+  void loadHistory(const Handle(ShapeHistory)& theHistory,
+                   const TopoShape&            theShape,
+                   const TopAbs_ShapeEnum      theType,
+                   const TNaming_Evolution     theEvolution);
+
   Handle(TNaming_UsedShapes) myShapes;
   Handle(ShapeAttribute) myAtt;
 };
@@ -15,6 +15,8 @@
 // commercial license or contractual agreement.
 
 #include <BRepBuilderAPI_MakeVertex.hxx>
+#include <BRepTools_History.hxx>
+#include <NCollection_Vector.hxx>
 #include <Standard.hxx>
 #include <Standard_ConstructionError.hxx>
 #include <Standard_GUID.hxx>
@@ -41,7 +43,9 @@
 #include <TNaming_SameShapeIterator.hxx>
 #include <TNaming_Tool.hxx>
 #include <TNaming_UsedShapes.hxx>
+#include <TopExp.hxx>
 #include <TopoDS_Shape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(ShapeAttribute, TDF_Attribute)
 
@@ -626,6 +630,41 @@ static void UpdateFirstUseOrNextSameShape(TNaming_RefShape*& prs, TNaming_Node*&
 
 //=================================================================================================
 
+static TNaming_RefShape* FindOrBindRefShape(TNaming_DataMapOfShapePtrRefShape& theMap,
+                                            const TopoShape&                   theShape)
+{
+  if (TNaming_PtrRefShape* aRef = theMap.ChangeSeek(theShape))
+  {
+    return *aRef;
+  }
+  TNaming_RefShape* aRef = new TNaming_RefShape(theShape);
+  theMap.Bind(theShape, aRef);
+  return aRef;
+}
+
+//=================================================================================================
+
+static void AppendUse(TNaming_RefShape*                                      prs,
+                      TNaming_Node*                                          pdn,
+                      NCollection_DataMap<TNaming_RefShape*, TNaming_Node*>& theLastUses)
+{
+  // the chain of uses of the shape is walked only once, then the last node is remembered
+  if (TNaming_Node** aLastUse = theLastUses.ChangeSeek(prs))
+  {
+    TNaming_Node* ldn = *aLastUse;
+    if (ldn->myOld == prs)
+      ldn->nextSameOld = pdn;
+    if (ldn->myNew == prs)
+      ldn->nextSameNew = pdn;
+    *aLastUse = pdn;
+    return;
+  }
+  UpdateFirstUseOrNextSameShape(prs, pdn);
+  theLastUses.Bind(prs, pdn);
+}
+
+//=================================================================================================
+
 void TNaming_Builder::Generated(const TopoShape& newShape)
 {
   if (myAtt->myNode == 0L)
@@ -718,23 +757,8 @@ void TNaming_Builder::Generated(const TopoShape& oldShape, const TopoShape& newS
 #endif
     return;
   }
-  TNaming_RefShape* pos;
-  if (!myShapes->myMap.IsBound(oldShape))
-  {
-    pos = new TNaming_RefShape(oldShape);
-    myShapes->myMap.Bind(oldShape, pos);
-  }
-  else
-    pos = myShapes->myMap.ChangeFind(oldShape);
-
-  TNaming_RefShape* pns;
-  if (!myShapes->myMap.IsBound(newShape))
-  {
-    pns = new TNaming_RefShape(newShape);
-    myShapes->myMap.Bind(newShape, pns);
-  }
-  else
-    pns = myShapes->myMap.ChangeFind(newShape);
+  TNaming_RefShape* pos = FindOrBindRefShape(myShapes->myMap, oldShape);
+  TNaming_RefShape* pns = FindOrBindRefShape(myShapes->myMap, newShape);
 
   TNaming_Node* pdn = new TNaming_Node(pos, pns);
   myAtt->Add(pdn);
@@ -761,23 +785,8 @@ void TNaming_Builder::Modify(const TopoShape& oldShape, const TopoShape& newShap
 #endif
     return;
   }
-  TNaming_RefShape* pos;
-  if (!myShapes->myMap.IsBound(oldShape))
-  {
-    pos = new TNaming_RefShape(oldShape);
-    myShapes->myMap.Bind(oldShape, pos);
-  }
-  else
-    pos = myShapes->myMap.ChangeFind(oldShape);
-
-  TNaming_RefShape* pns;
-  if (!myShapes->myMap.IsBound(newShape))
-  {
-    pns = new TNaming_RefShape(newShape);
-    myShapes->myMap.Bind(newShape, pns);
-  }
-  else
-    pns = myShapes->myMap.ChangeFind(newShape);
+  TNaming_RefShape* pos = FindOrBindRefShape(myShapes->myMap, oldShape);
+  TNaming_RefShape* pns = FindOrBindRefShape(myShapes->myMap, newShape);
 
   TNaming_Node* pdn = new TNaming_Node(pos, pns);
   myAtt->Add(pdn);
@@ -797,28 +806,115 @@ void TNaming_Builder::Select(const TopoShape& S, const TopoShape& InS)
       throw Standard_ConstructionError("TNaming_Builder : not same evolution");
   }
 
-  TNaming_RefShape* pos;
-  if (!myShapes->myMap.IsBound(InS))
+  TNaming_RefShape* pos = FindOrBindRefShape(myShapes->myMap, InS);
+  TNaming_RefShape* pns = FindOrBindRefShape(myShapes->myMap, S);
+
+  TNaming_Node* pdn = new TNaming_Node(pos, pns);
+  myAtt->Add(pdn);
+  UpdateFirstUseOrNextSameShape(pos, pdn);
+  UpdateFirstUseOrNextSameShape(pns, pdn);
+}
+
+//=================================================================================================
+
+void TNaming_Builder::Modify(const Handle(ShapeHistory)& theHistory,
+                             const TopoShape&            theShape,
+                             const TopAbs_ShapeEnum      theType)
+{
+  loadHistory(theHistory, theShape, theType, TNaming_MODIFY);
+}
+
+//=================================================================================================
+
+void TNaming_Builder::Generated(const Handle(ShapeHistory)& theHistory,
+                                const TopoShape&            theShape,
+                                const TopAbs_ShapeEnum      theType)
+{
+  loadHistory(theHistory, theShape, theType, TNaming_GENERATED);
+}
+
+//=================================================================================================
+
+void TNaming_Builder::Delete(const Handle(ShapeHistory)& theHistory,
+                             const TopoShape&            theShape,
+                             const TopAbs_ShapeEnum      theType)
+{
+  loadHistory(theHistory, theShape, theType, TNaming_DELETE);
+}
+
+//=================================================================================================
+
+void TNaming_Builder::loadHistory(const Handle(ShapeHistory)& theHistory,
+                                  const TopoShape&            theShape,
+                                  const TopAbs_ShapeEnum      theType,
+                                  const TNaming_Evolution     theEvolution)
+{
+  if (myAtt->myNode == 0L)
+    myAtt->myEvolution = theEvolution;
+  else
   {
-    pos = new TNaming_RefShape(InS);
-    myShapes->myMap.Bind(InS, pos);
+    if (myAtt->myEvolution != theEvolution)
+      throw Standard_ConstructionError("TNaming_Builder : not same evolution");
+  }
+  if (theHistory.IsNull() || theShape.IsNull())
+  {
+    return;
   }
-  else
-    pos = myShapes->myMap.ChangeFind(InS);
 
-  TNaming_RefShape* pns;
-  if (!myShapes->myMap.IsBound(S))
+  // collect the pairs of old and new shapes first to reserve the map of used shapes at once
+  TopTools_IndexedMapOfShape aSubShapes;
+  TopExp1::MapShapes(theShape, theType, aSubShapes);
+  NCollection_Vector<TopoShape> anOldShapes, aNewShapes;
+  for (Standard_Integer anIndex = 1; anIndex <= aSubShapes.Extent(); ++anIndex)
   {
-    pns = new TNaming_RefShape(S);
-    myShapes->myMap.Bind(S, pns);
+    const TopoShape& anOldShape = aSubShapes(anIndex);
+    if (theEvolution == TNaming_DELETE)
+    {
+      if (theHistory->IsRemoved(anOldShape))
+      {
+        anOldShapes.Append(anOldShape);
+        aNewShapes.Append(TopoShape());
+      }
+      continue;
+    }
+
+    const ShapeList& aNewList = theEvolution == TNaming_MODIFY
+                                  ? theHistory->Modified(anOldShape)
+                                  : theHistory->Generated(anOldShape);
+    for (TopTools_ListIteratorOfListOfShape anIter(aNewList); anIter.More(); anIter.Next())
+    {
+      if (!anOldShape.IsSame(anIter.Value()))
+      {
+        anOldShapes.Append(anOldShape);
+        aNewShapes.Append(anIter.Value());
+      }
+    }
+  }
+  if (anOldShapes.IsEmpty())
+  {
+    return;
   }
-  else
-    pns = myShapes->myMap.ChangeFind(S);
 
-  TNaming_Node* pdn = new TNaming_Node(pos, pns);
-  myAtt->Add(pdn);
-  UpdateFirstUseOrNextSameShape(pos, pdn);
-  UpdateFirstUseOrNextSameShape(pns, pdn);
+  TNaming_DataMapOfShapePtrRefShape& aMap = myShapes->myMap;
+  aMap.ReSize(aMap.Extent() + 2 * anOldShapes.Length());
+  NCollection_DataMap<TNaming_RefShape*, TNaming_Node*> aLastUses(2 * anOldShapes.Length());
+  for (Standard_Integer anIndex = 0; anIndex < anOldShapes.Length(); ++anIndex)
+  {
+    TNaming_RefShape* pos = FindOrBindRefShape(aMap, anOldShapes(anIndex));
+    TNaming_RefShape* pns;
+    if (theEvolution == TNaming_DELETE)
+    {
+      pns = new TNaming_RefShape(aNewShapes(anIndex));
+      aMap.Bind(aNewShapes(anIndex), pns);
+    }
+    else
+      pns = FindOrBindRefShape(aMap, aNewShapes(anIndex));
+
+    TNaming_Node* pdn = new TNaming_Node(pos, pns);
+    myAtt->Add(pdn);
+    AppendUse(pos, pdn, aLastUses);
+    AppendUse(pns, pdn, aLastUses);
+  }
 }
 
 //**********************************************************************
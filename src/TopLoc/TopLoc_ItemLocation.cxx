@@ -24,7 +24,8 @@
 TopLoc_ItemLocation::TopLoc_ItemLocation(const Handle(Datum3D2)& D, const Standard_Integer P)
     : myDatum(D),
       myPower(P),
-      myTrsf(D->Transformation().Powered(P))
+      myTrsf(D->Transformation().Powered(P)),
+      myHash(0)
 {
 }
 
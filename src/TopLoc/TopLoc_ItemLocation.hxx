@@ -56,6 +56,7 @@ private:
   Handle(Datum3D2) myDatum;
   Standard_Integer       myPower;
   Transform3d                myTrsf;
+  size_t                 myHash; //!< hash code of the chain of items starting from this one
 };
 
 #endif // _TopLoc_ItemLocation_HeaderFile
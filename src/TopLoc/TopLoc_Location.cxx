@@ -185,6 +185,11 @@ Standard_Boolean TopLoc_Location::IsEqual(const TopLoc_Location& Other) const
   {
     return Standard_False;
   }
+  // different chains are rejected by their hash codes without walking them
+  if (myItems.Value().myHash != Other.myItems.Value().myHash)
+  {
+    return Standard_False;
+  }
   if (FirstDatum() != Other.FirstDatum())
   {
     return Standard_False;
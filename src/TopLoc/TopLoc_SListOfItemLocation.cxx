@@ -14,7 +14,9 @@
 // Alternatively, this file may be used under the terms of Open CASCADE
 // commercial license or contractual agreement.
 
+#include <Standard_HashUtils.hxx>
 #include <Standard_NoSuchObject.hxx>
+#include <TopLoc_Datum3D.hxx>
 #include <TopLoc_ItemLocation.hxx>
 #include <TopLoc_SListNodeOfItemLocation.hxx>
 #include <TopLoc_SListOfItemLocation.hxx>
@@ -25,11 +27,22 @@ TopLoc_SListOfItemLocation::TopLoc_SListOfItemLocation(const TopLoc_ItemLocation
                                                        const TopLoc_SListOfItemLocation& aTail)
     : myNode(new TopLoc_SListNodeOfItemLocation(anItem, aTail))
 {
+  // the composed transformation and hash code of the chain are stored in its head
+  TopLoc_ItemLocation& aHead = myNode->Value();
+  size_t               aCombined[3];
+  aCombined[0] = std::hash<Handle(Datum3D2)>{}(aHead.myDatum);
+  aCombined[1] = opencascade::hash(aHead.myPower);
   if (!myNode->Tail().IsEmpty())
   {
-    const Transform3d& aT = myNode->Tail().Value().myTrsf;
-    myNode->Value().myTrsf.PreMultiply(aT);
+    const TopLoc_ItemLocation& aTailHead = myNode->Tail().Value();
+    aHead.myTrsf.PreMultiply(aTailHead.myTrsf);
+    aCombined[2] = aTailHead.myHash;
   }
+  else
+  {
+    aCombined[2] = opencascade::MurmurHash::optimalSeed<size_t>();
+  }
+  aHead.myHash = opencascade::hashBytes(aCombined, sizeof(aCombined));
 }
 
 //=================================================================================================
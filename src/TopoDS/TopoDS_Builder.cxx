@@ -17,7 +17,6 @@
 #include <Standard_NullObject.hxx>
 #include <TopoDS_Builder.hxx>
 #include <TopoDS_FrozenShape.hxx>
-#include <TopoDS_ListIteratorOfListOfShape.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_TShape.hxx>
 #include <TopoDS_TWire.hxx>
@@ -76,9 +75,7 @@ void TopoBuilder::Add(TopoShape& aShape, const TopoShape& aComponent) const
     //
     if ((aTb[iC] & (1 << iS)) != 0)
     {
-      TopoDS_ListOfShape& L = aShape.TShape()->myShapes;
-      L.Append(aComponent);
-      TopoShape& S = L.Last();
+      TopoShape& S = aShape.TShape()->appendChild(aComponent);
       //
       // compute the relative Orientation
       if (aShape.Orientation() == TopAbs_REVERSED)
@@ -119,16 +116,8 @@ void TopoBuilder::Remove(TopoShape& aShape, const TopoShape& aComponent) const
     S.Reverse();
   S.Location(S.Location().Predivided(aShape.Location()), Standard_False);
 
-  TopoDS_ListOfShape&              L = aShape.TShape()->myShapes;
-  TopoDS_ListIteratorOfListOfShape It(L);
-  while (It.More())
+  if (aShape.TShape()->removeChild(S))
   {
-    if (It.Value() == S)
-    {
-      L.Remove(It);
-      aShape.TShape()->Modified(Standard_True);
-      break;
-    }
-    It.Next();
+    aShape.TShape()->Modified(Standard_True);
   }
 }
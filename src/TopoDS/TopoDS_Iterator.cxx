@@ -33,14 +33,12 @@ void TopoDS_Iterator::Initialize(const TopoShape&    S,
   else
     myOrientation = TopAbs_FORWARD;
 
-  if (S.IsNull())
-    myShapes = TopoDS_ListIteratorOfListOfShape();
-  else
-    myShapes.Initialize(S.TShape()->myShapes);
+  myTShape = S.TShape().get();
+  myIndex  = 0;
 
   if (More())
   {
-    myShape = myShapes.Value();
+    myShape = myTShape->myShapes[myIndex];
     myShape.Orientation(TopAbs1::Compose(myOrientation, myShape.Orientation()));
     if (!myLocation.IsIdentity())
       myShape.Move(myLocation, Standard_False);
@@ -51,10 +49,10 @@ void TopoDS_Iterator::Initialize(const TopoShape&    S,
 
 void TopoDS_Iterator::Next()
 {
-  myShapes.Next();
+  ++myIndex;
   if (More())
   {
-    myShape = myShapes.Value();
+    myShape = myTShape->myShapes[myIndex];
     myShape.Orientation(TopAbs1::Compose(myOrientation, myShape.Orientation()));
     if (!myLocation.IsIdentity())
       myShape.Move(myLocation, Standard_False);
@@ -19,7 +19,6 @@
 
 #include <Standard_NoSuchObject.hxx>
 #include <TopoDS_Shape.hxx>
-#include <TopoDS_ListIteratorOfListOfShape.hxx>
 #include <TopAbs_Orientation.hxx>
 #include <TopLoc_Location.hxx>
 
@@ -35,7 +34,9 @@ public:
 
   //! Creates an empty Iterator.
   TopoDS_Iterator()
-      : myOrientation(TopAbs_FORWARD)
+      : myTShape(NULL),
+        myIndex(0),
+        myOrientation(TopAbs_FORWARD)
   {
   }
 
@@ -66,7 +67,7 @@ public:
 
   //! Returns true if there is another sub-shape in the
   //! shape which this iterator is scanning.
-  Standard_Boolean More() const { return myShapes.More(); }
+  Standard_Boolean More() const { return myTShape != NULL && myIndex < myTShape->NbChildren(); }
 
   //! Moves on to the next sub-shape in the shape which
   //! this iterator is scanning.
@@ -85,10 +86,11 @@ public:
   }
 
 private:
-  TopoShape                     myShape;
-  TopoDS_ListIteratorOfListOfShape myShapes;
-  TopAbs_Orientation               myOrientation;
-  TopLoc_Location                  myLocation;
+  TopoShape            myShape;
+  const TopoShapeBase* myTShape; //!< iterated shape, its sub-shapes are accessed by index
+  Standard_Integer     myIndex;  //!< index of the current sub-shape
+  TopAbs_Orientation   myOrientation;
+  TopLoc_Location      myLocation;
 };
 
 #endif // _TopoDS_Iterator_HeaderFile
@@ -19,10 +19,72 @@
 
 #include <Standard_Dump.hxx>
 
+#include <new>
+
 IMPLEMENT_STANDARD_RTTIEXT(TopoShapeBase, RefObject)
 
 //=================================================================================================
 
+TopoShapeBase::~TopoShapeBase()
+{
+  for (Standard_Integer anIndex = 0; anIndex < myNbShapes; ++anIndex)
+  {
+    myShapes[anIndex].~TopoShape();
+  }
+  Standard1::Free(myShapes);
+}
+
+//=================================================================================================
+
+TopoShape& TopoShapeBase::appendChild(const TopoShape& theShape)
+{
+  if ((myNbShapes & (myNbShapes - 1)) == 0)
+  {
+    // the block is full (or absent), move the sub-shapes into a twice larger one
+    const Standard_Integer aCapacity = myNbShapes == 0 ? 1 : 2 * myNbShapes;
+    TopoShape*             aShapes =
+      static_cast<TopoShape*>(Standard1::Allocate(aCapacity * sizeof(TopoShape)));
+    for (Standard_Integer anIndex = 0; anIndex < myNbShapes; ++anIndex)
+    {
+      new (aShapes + anIndex) TopoShape(std::move(myShapes[anIndex]));
+      myShapes[anIndex].~TopoShape();
+    }
+    Standard1::Free(myShapes);
+    myShapes = aShapes;
+  }
+  TopoShape* aShape = new (myShapes + myNbShapes) TopoShape(theShape);
+  ++myNbShapes;
+  return *aShape;
+}
+
+//=================================================================================================
+
+Standard_Boolean TopoShapeBase::removeChild(const TopoShape& theShape)
+{
+  for (Standard_Integer anIndex = 0; anIndex < myNbShapes; ++anIndex)
+  {
+    if (myShapes[anIndex] != theShape)
+    {
+      continue;
+    }
+    for (Standard_Integer aNext = anIndex + 1; aNext < myNbShapes; ++aNext)
+    {
+      myShapes[aNext - 1] = std::move(myShapes[aNext]);
+    }
+    myShapes[--myNbShapes].~TopoShape();
+    if (myNbShapes == 0)
+    {
+      // the next child is appended into a new block
+      Standard1::Free(myShapes);
+      myShapes = NULL;
+    }
+    return Standard_True;
+  }
+  return Standard_False;
+}
+
+//=================================================================================================
+
 void TopoShapeBase::DumpJson(Standard_OStream& theOStream, Standard_Integer) const
 {
   OCCT_DUMP_TRANSIENT_CLASS_BEGIN(theOStream)
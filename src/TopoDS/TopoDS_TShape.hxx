@@ -36,7 +36,7 @@
 //! TShapes are   defined   by  their  optional domain
 //! (geometry)  and  their  components  (other TShapes
 //! with  Locations and Orientations).  The components
-//! are stored in a List of Shapes.
+//! are stored contiguously in an array of Shapes.
 //!
 //! A   TShape contains  the   following boolean flags :
 //!
@@ -130,7 +130,7 @@ public:
 
   //! Returns the number of direct sub-shapes (children).
   //! @sa TopoDS_Iterator for accessing sub-shapes
-  Standard_Integer NbChildren() const { return myShapes.Size(); }
+  Standard_Integer NbChildren() const { return myNbShapes; }
 
   //! Dumps the content of me into the stream
   Standard_EXPORT virtual void DumpJson(Standard_OStream& theOStream,
@@ -139,6 +139,9 @@ public:
   friend class TopoDS_Iterator;
   friend class TopoBuilder;
 
+  //! Destructor, releases the sub-shapes.
+  Standard_EXPORT virtual ~TopoShapeBase();
+
   DEFINE_STANDARD_RTTIEXT(TopoShapeBase, RefObject)
 
 protected:
@@ -151,7 +154,9 @@ protected:
   //! Infinite   : False
   //! Convex     : False
   TopoShapeBase()
-      : myFlags(TopoDS_TShape_Flags_Free | TopoDS_TShape_Flags_Modified
+      : myShapes(NULL),
+        myNbShapes(0),
+        myFlags(TopoDS_TShape_Flags_Free | TopoDS_TShape_Flags_Modified
                 | TopoDS_TShape_Flags_Orientable)
   {
   }
@@ -179,9 +184,25 @@ private:
       myFlags &= ~(Standard_Integer)theFlag;
   }
 
+  //! Appends the sub-shape to the end of the array of sub-shapes,
+  //! returns the reference to the stored copy.
+  Standard_EXPORT TopoShape& appendChild(const TopoShape& theShape);
+
+  //! Removes the first sub-shape equal to the given one, keeping the order of the others.
+  //! Returns false if there is no such sub-shape.
+  Standard_EXPORT Standard_Boolean removeChild(const TopoShape& theShape);
+
+  // copying is prohibited
+  TopoShapeBase(const TopoShapeBase&);
+  TopoShapeBase& operator=(const TopoShapeBase&);
+
 private:
-  TopoDS_ListOfShape myShapes;
-  Standard_Integer   myFlags;
+  // The sub-shapes are stored in a single memory block. Its capacity is not kept:
+  // the block is reallocated twice larger when the number of sub-shapes being
+  // a power of two is exceeded, and released when the last sub-shape is removed.
+  TopoShape*       myShapes;
+  Standard_Integer myNbShapes;
+  Standard_Integer myFlags;
 };
 
 DEFINE_STANDARD_HANDLE(TopoShapeBase, RefObject)
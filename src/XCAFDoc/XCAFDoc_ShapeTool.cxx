@@ -27,7 +27,6 @@
 #include <TDataStd_TreeNode.hxx>
 #include <TDataStd_UAttribute.hxx>
 #include <TDF_Attribute.hxx>
-#include <TDF_ChildIDIterator.hxx>
 #include <TDF_ChildIterator.hxx>
 #include <TDF_Label.hxx>
 #include <TDF_LabelMap.hxx>
@@ -36,12 +35,14 @@
 #include <TDF_Tool.hxx>
 #include <TDocStd_Document.hxx>
 #include <TNaming_Builder.hxx>
+#include <TNaming_SameShapeIterator.hxx>
 #include <TNaming_Tool.hxx>
 #include <TopLoc_IndexedMapOfLocation.hxx>
 #include <TopLoc_Location.hxx>
 #include <TopoDS_Compound.hxx>
 #include <TopoDS_Iterator.hxx>
 #include <TopoDS_Shape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <TopTools_ListOfShape.hxx>
 #include <TopTools_MapOfOrientedShape.hxx>
 #include <XCAFDoc.hxx>
@@ -81,8 +82,9 @@ Handle(XCAFDoc_ShapeTool) XCAFDoc_ShapeTool::Set(const DataLabel& L)
 //=================================================================================================
 
 XCAFDoc_ShapeTool::XCAFDoc_ShapeTool()
+    : hasSimpleShapes(Standard_False),
+      myIsMainShapesIndexed(false)
 {
-  hasSimpleShapes = Standard_False;
 }
 
 //=================================================================================================
@@ -272,22 +274,22 @@ Standard_Boolean XCAFDoc_ShapeTool::FindShape(const TopoShape&    S,
   if (IsTopLevel(L))
     return Standard_True;
 
-  // Try to find shape manually
-  TDF_ChildIDIterator it(Label(), ShapeAttribute::GetID());
-  for (; it.More(); it.Next())
+  // Try to find shape among the other labels keeping it, the first top-level one
+  DataLabel aFoundL;
+  for (SameShapeIterator it(S0, Label()); it.More(); it.Next())
   {
-    DataLabel                  aLabel = it.Value()->Label();
+    DataLabel                  aLabel = it.Label();
     Handle(ShapeAttribute) NS;
-    if (aLabel.FindAttribute(ShapeAttribute::GetID(), NS)
+    if (IsTopLevel(aLabel) && (aFoundL.IsNull() || aLabel.Tag() < aFoundL.Tag())
+        && aLabel.FindAttribute(ShapeAttribute::GetID(), NS)
         && S0.IsSame(Tool11::GetShape(NS)))
     {
-      L = aLabel;
-      return Standard_True;
+      aFoundL = aLabel;
     }
   }
 
-  L = DataLabel();
-  return Standard_False;
+  L = aFoundL;
+  return !L.IsNull();
 }
 
 //=================================================================================================
@@ -409,6 +411,8 @@ void XCAFDoc_ShapeTool::SetShape(const DataLabel& L, const TopoShape& S)
   //    L.AddAttribute(A);
   //  }
   A->SetShape(S);
+  // the previous shape of the label could be a main shape of other sub-shapes
+  resetMainShapes();
 
   if (!myShapeLabels.IsBound(S))
   {
@@ -551,6 +555,7 @@ DataLabel XCAFDoc_ShapeTool::addShape(const TopoShape& S, const Standard_Boolean
       }
     }
     // mySubShapes.Bind(ShapeLabel,A->GetMap());
+    indexMainShape(ShapeLabel);
   }
 
   return ShapeLabel;
@@ -635,6 +640,7 @@ Standard_Boolean XCAFDoc_ShapeTool::RemoveShape(const DataLabel&       L,
   }
 
   L.ForgetAllAttributes(Standard_True);
+  resetMainShapes();
 
   if (removeCompletely && !aLabel.IsNull())
   {
@@ -1042,25 +1048,24 @@ Standard_Boolean XCAFDoc_ShapeTool::FindSubShape(const DataLabel&    shapeL,
     return Standard_False;
   }
 
-  // if subshape was found wrong, try to do it manually
+  // if subshape was found wrong, look through the other labels keeping it
   // it can be possible if several part shapes has the same subshapes
   L = DataLabel();
-  ChildIterator aChldLabIt(shapeL);
-  for (; aChldLabIt.More(); aChldLabIt.Next())
+  for (SameShapeIterator aSameIt(sub, shapeL); aSameIt.More(); aSameIt.Next())
   {
-    DataLabel                  aSubLabel = aChldLabIt.Value();
+    DataLabel                  aSubLabel = aSameIt.Label();
     Handle(ShapeAttribute) NS;
-    if (!aSubLabel.FindAttribute(ShapeAttribute::GetID(), NS))
+    if (aSubLabel.Father() != shapeL || (!L.IsNull() && L.Tag() < aSubLabel.Tag())
+        || !aSubLabel.FindAttribute(ShapeAttribute::GetID(), NS))
       continue;
     TopoShape aSubShape = Tool11::GetShape(NS);
     if (!aSubShape.IsNull() && aSubShape.IsSame(sub))
     {
       L = aSubLabel;
-      return Standard_True;
     }
   }
 
-  return Standard_False;
+  return !L.IsNull();
 }
 
 //=================================================================================================
@@ -1135,17 +1140,55 @@ DataLabel XCAFDoc_ShapeTool::FindMainShapeUsingMap(const TopoShape& sub) const
   return L0;
 }
 
+//=======================================================================
+// function : collectSubShapes
+// purpose  : Adds the sub-shapes of the shape into the map as XCAFDoc_ShapeMapTool does
+//=======================================================================
+
+static void collectSubShapes(const TopoShape& theShape, TopTools_IndexedMapOfShape& theMap)
+{
+  for (TopoDS_Iterator it(theShape); it.More(); it.Next())
+  {
+    theMap.Add(it.Value());
+    collectSubShapes(it.Value(), theMap);
+  }
+}
+
+//=======================================================================
+// function : isMainShapeOf
+// purpose  : Checks the sub-shape as IsSubShape() without adding XCAFDoc_ShapeMapTool
+//=======================================================================
+
+static Standard_Boolean isMainShapeOf(const DataLabel& theLabel, const TopoShape& theSub)
+{
+  Handle(XCAFDoc_ShapeMapTool) A;
+  if (theLabel.FindAttribute(XCAFDoc_ShapeMapTool::GetID(), A))
+    return A->IsSubShape(theSub);
+
+  TopTools_IndexedMapOfShape aSubShapes;
+  collectSubShapes(XCAFDoc_ShapeTool::GetShape(theLabel), aSubShapes);
+  return aSubShapes.Contains(theSub);
+}
+
 //=================================================================================================
 
 DataLabel XCAFDoc_ShapeTool::FindMainShape(const TopoShape& sub) const
 {
-  ChildIterator it(Label());
-  for (; it.More(); it.Next())
+  indexMainShapes();
+
+  // the index is not modified here, as the search can be done from different threads
+  if (const DataLabel* aMainL = myMainShapes.Seek(sub))
   {
-    DataLabel L = it.Value();
+    // check the found label, as the document could be modified not through this tool
+    if (IsTopLevel(*aMainL) && IsSimpleShape(*aMainL) && isMainShapeOf(*aMainL, sub))
+      return *aMainL;
 
-    if (IsSimpleShape(L) && IsSubShape(L, sub))
-      return L;
+    for (ChildIterator it(Label()); it.More(); it.Next())
+    {
+      const DataLabel& L = it.Value();
+      if (IsSimpleShape(L) && isMainShapeOf(L, sub))
+        return L;
+    }
   }
   DataLabel L0;
   return L0;
@@ -1153,6 +1196,77 @@ DataLabel XCAFDoc_ShapeTool::FindMainShape(const TopoShape& sub) const
 
 //=================================================================================================
 
+void XCAFDoc_ShapeTool::indexMainShape(const DataLabel& theLabel)
+{
+  Handle(XCAFDoc_ShapeMapTool) A;
+  if (!myIsMainShapesIndexed || !IsTopLevel(theLabel) || !IsSimpleShape(theLabel)
+      || !theLabel.FindAttribute(XCAFDoc_ShapeMapTool::GetID(), A))
+    return;
+
+  for (Standard_Integer i = 1; i <= A->GetMap().Extent(); i++)
+  {
+    const TopoShape& aSh    = A->GetMap().FindKey(i);
+    DataLabel*          aMainL = myMainShapes.ChangeSeek(aSh);
+    if (aMainL == NULL)
+      myMainShapes.Bind(aSh, theLabel);
+    else if (*aMainL != theLabel && (aMainL->Tag() > theLabel.Tag() || !IsSimpleShape(*aMainL)))
+      *aMainL = theLabel;
+  }
+}
+
+//=================================================================================================
+
+void XCAFDoc_ShapeTool::indexMainShapes() const
+{
+  if (myIsMainShapesIndexed)
+    return;
+
+  Standard_Mutex::Sentry aSentry(myMainShapesMutex);
+  if (myIsMainShapesIndexed)
+    return;
+
+  myMainShapes.Clear();
+  for (ChildIterator it(Label()); it.More(); it.Next())
+  {
+    const DataLabel& L = it.Value();
+    if (!IsSimpleShape(L))
+      continue;
+
+    // labels are iterated in increasing order of tags, the first one is kept
+    Handle(XCAFDoc_ShapeMapTool) A;
+    if (L.FindAttribute(XCAFDoc_ShapeMapTool::GetID(), A))
+    {
+      for (Standard_Integer i = 1; i <= A->GetMap().Extent(); i++)
+      {
+        if (!myMainShapes.IsBound(A->GetMap().FindKey(i)))
+          myMainShapes.Bind(A->GetMap().FindKey(i), L);
+      }
+    }
+    else
+    {
+      TopTools_IndexedMapOfShape aSubShapes;
+      collectSubShapes(GetShape(L), aSubShapes);
+      for (Standard_Integer i = 1; i <= aSubShapes.Extent(); i++)
+      {
+        if (!myMainShapes.IsBound(aSubShapes.FindKey(i)))
+          myMainShapes.Bind(aSubShapes.FindKey(i), L);
+      }
+    }
+  }
+  myIsMainShapesIndexed = true;
+}
+
+//=================================================================================================
+
+void XCAFDoc_ShapeTool::resetMainShapes() const
+{
+  Standard_Mutex::Sentry aSentry(myMainShapesMutex);
+  myIsMainShapesIndexed = false;
+  myMainShapes.Clear();
+}
+
+//=================================================================================================
+
 Standard_Boolean XCAFDoc_ShapeTool::GetSubShapes(const DataLabel& L, TDF_LabelSequence& Labels)
 {
   ChildIterator It(L);
@@ -1841,7 +1955,8 @@ Standard_Boolean XCAFDoc_ShapeTool::Expand(const DataLabel& theShapeL)
                                     || aShapeType == TopAbs_SHELL || aShapeType == TopAbs_WIRE;
   if (isExpandedType)
   {
-    TopoDS_Iterator anIter(aShape);
+    TDF_LabelSequence aParts;
+    TopoDS_Iterator   anIter(aShape);
     for (; anIter.More(); anIter.Next())
     {
       const TopoShape& aChildShape = anIter.Value();
@@ -1893,9 +2008,15 @@ Standard_Boolean XCAFDoc_ShapeTool::Expand(const DataLabel& theShapeL)
       }
       MakeReference(aChild, aPart, aChildShape.Location());
       makeSubShape(theShapeL, aPart, aChildShape, aChildShape.Location());
+      aParts.Append(aPart);
     }
     // set assembly attribute
     TDataStd_UAttribute::Set(theShapeL, XCAFDoc1::AssemblyGUID());
+    // sub-shapes of the expanded shape now belong to its parts
+    for (TDF_LabelSequence::Iterator aPartIt(aParts); aPartIt.More(); aPartIt.Next())
+    {
+      indexMainShape(aPartIt.Value());
+    }
     return Standard_True;
   }
   return Standard_False;
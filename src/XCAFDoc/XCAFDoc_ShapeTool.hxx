@@ -25,6 +25,7 @@
 #include <TDF_LabelMap.hxx>
 #include <TDF_LabelSequence.hxx>
 #include <Standard_Integer.hxx>
+#include <Standard_Mutex.hxx>
 #include <Standard_OStream.hxx>
 #include <TColStd_SequenceOfHAsciiString.hxx>
 #include <TDF_AttributeSequence.hxx>
@@ -347,7 +348,10 @@ public:
   //! Performs a search among top-level shapes to find
   //! the shape containing <sub> as subshape
   //! Checks only simple shapes, and returns the first found
-  //! label (which should be the only one for valid model)
+  //! label (which should be the only one for valid model).
+  //! Uses the index of sub-shapes of top-level simple shapes, built at the first call
+  //! (the calls from different threads are safe) and updated by the methods of the tool
+  //! adding, setting or removing the shapes.
   Standard_EXPORT DataLabel FindMainShape(const TopoShape& sub) const;
 
   //! Returns list of labels identifying subshapes of the given shape
@@ -522,10 +526,24 @@ private:
                                     const TopoShape&    theShape,
                                     const TopLoc_Location& theLoc);
 
-  XCAFDoc_DataMapOfShapeLabel myShapeLabels;
-  XCAFDoc_DataMapOfShapeLabel mySubShapes;
-  XCAFDoc_DataMapOfShapeLabel mySimpleShapes;
-  Standard_Boolean            hasSimpleShapes;
+  //! Adds sub-shapes of the top-level simple shape to the index of main shapes if it is built.
+  //! A sub-shape shared by several shapes keeps the label with the smallest tag.
+  Standard_EXPORT void indexMainShape(const DataLabel& theLabel);
+
+  //! Builds the index of main shapes for all top-level simple shapes if it is not built yet.
+  //! Does not add attributes to the labels, so that it can be called from different threads.
+  Standard_EXPORT void indexMainShapes() const;
+
+  //! Clears the index of main shapes, it is built again on the next search.
+  Standard_EXPORT void resetMainShapes() const;
+
+  XCAFDoc_DataMapOfShapeLabel         myShapeLabels;
+  XCAFDoc_DataMapOfShapeLabel         mySubShapes;
+  XCAFDoc_DataMapOfShapeLabel         mySimpleShapes;
+  Standard_Boolean                    hasSimpleShapes;
+  mutable XCAFDoc_DataMapOfShapeLabel myMainShapes; //!< top-level simple shapes by sub-shapes
+  mutable std::atomic<bool>           myIsMainShapesIndexed;
+  mutable Standard_Mutex              myMainShapesMutex; //!< guards the building of the index
 };
 
 #endif // _XCAFDoc_ShapeTool_HeaderFile
@@ -19,6 +19,7 @@
 #include <BRepBndLib.hxx>
 #include <gp_Pnt.hxx>
 #include <Graphic3d_AspectFillArea3d.hxx>
+#include <OSD_Parallel.hxx>
 #include <Prs3d_Drawer.hxx>
 #include <Prs3d_DimensionAspect.hxx>
 #include <Prs3d_IsoAspect.hxx>
@@ -28,7 +29,11 @@
 #include <TDataStd_Name.hxx>
 #include <TPrsStd_AISPresentation.hxx>
 #include <TopoDS_Iterator.hxx>
+#include <XCAFDoc_ColorTool.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_LayerTool.hxx>
 #include <XCAFDoc_ShapeTool.hxx>
+#include <XCAFDoc_VisMaterialTool.hxx>
 #include <XCAFPrs.hxx>
 #include <XCAFPrs_IndexedDataMapOfShapeStyle.hxx>
 #include <XCAFPrs_Style.hxx>
@@ -201,6 +206,69 @@ void XCAFPrs_AISObject::DispatchStyles(const Standard_Boolean theToSyncStyles)
 
 //=================================================================================================
 
+namespace
+{
+//! Functor dispatching styles of presentations.
+class XCAFPrs_AISObject_StyleFunctor
+{
+public:
+  XCAFPrs_AISObject_StyleFunctor(const NCollection_Array1<Handle(XCAFPrs_AISObject)>& thePrsList,
+                                 const Standard_Boolean theToSyncStyles)
+      : myPrsList(&thePrsList),
+        myToSyncStyles(theToSyncStyles)
+  {
+  }
+
+  void operator()(const Standard_Integer theIndex) const
+  {
+    const Handle(XCAFPrs_AISObject)& aPrs = myPrsList->Value(theIndex);
+    if (!aPrs.IsNull())
+    {
+      aPrs->DispatchStyles(myToSyncStyles);
+    }
+  }
+
+private:
+  const NCollection_Array1<Handle(XCAFPrs_AISObject)>* myPrsList;
+  Standard_Boolean                                     myToSyncStyles;
+};
+} // namespace
+
+//=================================================================================================
+
+void XCAFPrs_AISObject::ParallelDispatchStyles(
+  const NCollection_Array1<Handle(XCAFPrs_AISObject)>& thePrsList,
+  const Standard_Boolean                               theToSyncStyles,
+  const Standard_Boolean                               theToParallel)
+{
+  // document tools are created on first access, so that they are fetched before starting threads
+  Handle(Data2) aLastData;
+  for (NCollection_Array1<Handle(XCAFPrs_AISObject)>::Iterator aPrsIter(thePrsList);
+       aPrsIter.More();
+       aPrsIter.Next())
+  {
+    const Handle(XCAFPrs_AISObject)& aPrs = aPrsIter.Value();
+    if (aPrs.IsNull() || aPrs->GetLabel().IsNull() || aPrs->GetLabel().Data() == aLastData)
+    {
+      continue;
+    }
+
+    const DataLabel& aLabel = aPrs->GetLabel();
+    aLastData               = aLabel.Data();
+    XCAFDoc_DocumentTool::ColorTool(aLabel)->ShapeTool();
+    XCAFDoc_DocumentTool::VisMaterialTool(aLabel)->ShapeTool();
+    XCAFDoc_DocumentTool::LayerTool(aLabel)->ShapeTool();
+  }
+
+  XCAFPrs_AISObject_StyleFunctor aFunctor(thePrsList, theToSyncStyles);
+  Parallel1::For(thePrsList.Lower(),
+                 thePrsList.Upper() + 1,
+                 aFunctor,
+                 !theToParallel || thePrsList.Size() < 2);
+}
+
+//=================================================================================================
+
 void XCAFPrs_AISObject::Compute(const Handle(PrsMgr_PresentationManager)& thePresentationManager,
                                 const Handle(Prs3d_Presentation)&         thePrs,
                                 const Standard_Integer                    theMode)
@@ -15,6 +15,7 @@
 #define _XCAFPrs_AISObject_HeaderFile
 
 #include <AIS_ColoredShape.hxx>
+#include <NCollection_Array1.hxx>
 
 #include <TDF_Label.hxx>
 
@@ -42,6 +43,18 @@ public:
   Standard_EXPORT virtual void DispatchStyles(
     const Standard_Boolean theToSyncStyles = Standard_False);
 
+  //! Call DispatchStyles() for the list of presentations using several threads.
+  //! Shapes and styles are only read from the documents, so that the documents
+  //! should not be modified concurrently. Presentations should not be displayed yet.
+  //! This reduces the time of displaying large assemblies split into many presentations.
+  //! @param thePrsList      presentations to prepare
+  //! @param theToSyncStyles flag passed to DispatchStyles()
+  //! @param theToParallel   flag to use several threads
+  Standard_EXPORT static void ParallelDispatchStyles(
+    const NCollection_Array1<Handle(XCAFPrs_AISObject)>& thePrsList,
+    const Standard_Boolean                               theToSyncStyles = Standard_False,
+    const Standard_Boolean                               theToParallel   = Standard_True);
+
   //! Sets the material aspect.
   //! This method assigns the new default material without overriding XDE styles.
   //! Re-computation of existing presentation is not required after calling this method.
@@ -14,6 +14,7 @@
 
 #include <XCAFPrs_DocumentExplorer.hxx>
 
+#include <OSD_Parallel.hxx>
 #include <TDF_Tool.hxx>
 #include <TDocStd_Document.hxx>
 #include <XCAFDoc_ColorTool.hxx>
@@ -80,6 +81,106 @@ static XCAFPrs_Style mergedStyle(const Handle(XCAFDoc_ColorTool)&       theColor
 
   return aStyle;
 }
+
+//! Node of the flattened tree of labels.
+struct FlatNode
+{
+  Standard_Integer Parent; //!< index of the parent node, -1 for the root
+  Standard_Integer Depth;  //!< depth of the node
+};
+
+//! Append the node and all its children (for assembly) into the flat list.
+static void collectFlatNodes(NCollection_Vector<XCAFPrs_DocumentNode>& theNodes,
+                             NCollection_Vector<FlatNode>&             theLinks,
+                             const DataLabel&                          theLabel,
+                             const DataLabel&                          theRefLabel,
+                             const Standard_Boolean                    theIsAssembly,
+                             const FlatNode&                           theLink)
+{
+  const Standard_Integer anIndex = theNodes.Length();
+  XCAFPrs_DocumentNode&  aNode   = theNodes.Appended();
+  aNode.Label                    = theLabel;
+  aNode.RefLabel                 = theRefLabel;
+  aNode.IsAssembly               = theIsAssembly;
+  theLinks.Append(theLink);
+  if (!theIsAssembly)
+  {
+    return;
+  }
+
+  const FlatNode aChildLink = {anIndex, theLink.Depth + 1};
+  for (ChildIterator aChildIter(theRefLabel); aChildIter.More(); aChildIter.Next())
+  {
+    const DataLabel& aChild = aChildIter.Value();
+    if (aChild.IsNull() || (!aChild.HasChild() && !aChild.HasAttribute()))
+    {
+      continue;
+    }
+
+    DataLabel aRefLabel = aChild;
+    XCAFDoc_ShapeTool::GetReferredShape(aChild, aRefLabel);
+    if (!XCAFDoc_ShapeTool::IsAssembly(aRefLabel))
+    {
+      collectFlatNodes(theNodes, theLinks, aChild, aRefLabel, Standard_False, aChildLink);
+    }
+    else if (aRefLabel.HasAttribute() || aRefLabel.HasChild())
+    {
+      collectFlatNodes(theNodes, theLinks, aChild, aRefLabel, Standard_True, aChildLink);
+    }
+  }
+}
+
+//! Functor resolving style, location and identifier of the nodes,
+//! which parents have been already resolved.
+class NodeResolver
+{
+public:
+  NodeResolver(NCollection_Vector<XCAFPrs_DocumentNode>& theNodes,
+               const NCollection_Vector<FlatNode>&       theLinks,
+               const NCollection_Vector<Standard_Integer>& theLevel,
+               const Handle(XCAFDoc_ColorTool)&          theColorTool,
+               const Handle(XCAFDoc_VisMaterialTool)&    theVisMatTool,
+               const XCAFPrs_Style&                      theDefStyle)
+      : myNodes(&theNodes),
+        myLinks(&theLinks),
+        myLevel(&theLevel),
+        myColorTool(theColorTool),
+        myVisMatTool(theVisMatTool),
+        myDefStyle(&theDefStyle)
+  {
+  }
+
+  void operator()(const Standard_Integer theIndex) const
+  {
+    const Standard_Integer      aNodeIndex = myLevel->Value(theIndex);
+    const Standard_Integer      aParent    = myLinks->Value(aNodeIndex).Parent;
+    XCAFPrs_DocumentNode&       aNode      = myNodes->ChangeValue(aNodeIndex);
+    aNode.LocalTrsf                        = XCAFDoc_ShapeTool::GetLocation(aNode.Label);
+    if (aParent < 0)
+    {
+      aNode.Location = aNode.LocalTrsf;
+      aNode.Style =
+        mergedStyle(myColorTool, myVisMatTool, *myDefStyle, aNode.Label, aNode.RefLabel);
+      aNode.Id = XCAFPrs_DocumentExplorer::DefineChildId(aNode.Label, AsciiString1());
+    }
+    else
+    {
+      const XCAFPrs_DocumentNode& aParentNode = myNodes->Value(aParent);
+      aNode.Location                          = aParentNode.Location * aNode.LocalTrsf;
+      aNode.Style =
+        mergedStyle(myColorTool, myVisMatTool, aParentNode.Style, aNode.Label, aNode.RefLabel);
+      aNode.Id = XCAFPrs_DocumentExplorer::DefineChildId(aNode.Label, aParentNode.Id);
+    }
+  }
+
+private:
+  NCollection_Vector<XCAFPrs_DocumentNode>*   myNodes;
+  const NCollection_Vector<FlatNode>*         myLinks;
+  const NCollection_Vector<Standard_Integer>* myLevel;
+  Handle(XCAFDoc_ColorTool)                   myColorTool;
+  Handle(XCAFDoc_VisMaterialTool)             myVisMatTool;
+  const XCAFPrs_Style*                        myDefStyle;
+};
 } // namespace
 
 //=================================================================================================
@@ -160,6 +261,80 @@ TopoShape XCAFPrs_DocumentExplorer::FindShapeFromPathId(
 
 //=================================================================================================
 
+void XCAFPrs_DocumentExplorer::CollectNodes(NCollection_Vector<XCAFPrs_DocumentNode>& theNodes,
+                                            const Handle(AppDocument)&          theDocument,
+                                            const TDF_LabelSequence&                  theRoots,
+                                            const XCAFPrs_DocumentExplorerFlags       theFlags,
+                                            const XCAFPrs_Style&                      theDefStyle,
+                                            const Standard_Boolean theToParallel)
+{
+  theNodes.Clear();
+
+  // tools are fetched (and created, if missing) before starting threads
+  Handle(XCAFDoc_ColorTool)       aColorTool;
+  Handle(XCAFDoc_VisMaterialTool) aVisMatTool;
+  if ((theFlags & XCAFPrs_DocumentExplorerFlags_NoStyle) == 0)
+  {
+    aColorTool  = XCAFDoc_DocumentTool::ColorTool(theDocument->Main());
+    aVisMatTool = XCAFDoc_DocumentTool::VisMaterialTool(theDocument->Main());
+  }
+
+  // walk the tree of labels including assemblies, which styles are inherited by children
+  NCollection_Vector<XCAFPrs_DocumentNode> aNodes;
+  NCollection_Vector<FlatNode>             aLinks;
+  const FlatNode                           aRootLink = {-1, 0};
+  for (TDF_LabelSequence::Iterator aRootIter(theRoots); aRootIter.More(); aRootIter.Next())
+  {
+    const DataLabel& aRootLab = aRootIter.Value();
+    if (aRootLab.IsNull())
+    {
+      continue;
+    }
+
+    DataLabel aRefLabel = aRootLab;
+    XCAFDoc_ShapeTool::GetReferredShape(aRootLab, aRefLabel);
+    collectFlatNodes(aNodes,
+                     aLinks,
+                     aRootLab,
+                     aRefLabel,
+                     XCAFDoc_ShapeTool::IsAssembly(aRefLabel),
+                     aRootLink);
+  }
+
+  // resolve nodes level by level, as each node depends only on its parent
+  NCollection_Vector<NCollection_Vector<Standard_Integer>> aLevels;
+  for (Standard_Integer aNodeIter = 0; aNodeIter < aLinks.Length(); ++aNodeIter)
+  {
+    const Standard_Integer aDepth = aLinks.Value(aNodeIter).Depth;
+    while (aLevels.Length() <= aDepth)
+    {
+      aLevels.Appended();
+    }
+    aLevels.ChangeValue(aDepth).Append(aNodeIter);
+  }
+  for (NCollection_Vector<NCollection_Vector<Standard_Integer>>::Iterator aLevelIter(aLevels);
+       aLevelIter.More();
+       aLevelIter.Next())
+  {
+    const NCollection_Vector<Standard_Integer>& aLevel = aLevelIter.Value();
+    NodeResolver aResolver(aNodes, aLinks, aLevel, aColorTool, aVisMatTool, theDefStyle);
+    Parallel1::For(0, aLevel.Length(), aResolver, !theToParallel || aLevel.Length() < 2);
+  }
+
+  const Standard_Boolean toSkipAssemblies =
+    (theFlags & XCAFPrs_DocumentExplorerFlags_OnlyLeafNodes) != 0;
+  for (NCollection_Vector<XCAFPrs_DocumentNode>::Iterator aNodeIter(aNodes); aNodeIter.More();
+       aNodeIter.Next())
+  {
+    if (!toSkipAssemblies || !aNodeIter.Value().IsAssembly)
+    {
+      theNodes.Append(aNodeIter.Value());
+    }
+  }
+}
+
+//=================================================================================================
+
 XCAFPrs_DocumentExplorer::XCAFPrs_DocumentExplorer()
     : myTop(-1),
       myHasMore(Standard_False),
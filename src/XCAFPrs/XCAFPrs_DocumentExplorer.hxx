@@ -79,6 +79,26 @@ public: //! @name string identification tools
     const Handle(AppDocument)& theDocument,
     const AsciiString1&  theId);
 
+public: //! @name document flattening
+  //! Collect the nodes, which would be visited by the explorer with the same parameters,
+  //! into a flat list keeping the same order.
+  //! The tree of labels is walked by the calling thread, while styles, locations and identifiers
+  //! of the nodes of the same depth are resolved by several threads.
+  //! Child iterators of the returned nodes are not initialized.
+  //! The document should not be modified concurrently.
+  //! @param theNodes     [out] collected nodes
+  //! @param theDocument  document to explore
+  //! @param theRoots     root labels to explore within specified document
+  //! @param theFlags     iteration flags
+  //! @param theDefStyle  default style for nodes with undefined style
+  //! @param theToParallel flag to resolve nodes in parallel threads
+  Standard_EXPORT static void CollectNodes(NCollection_Vector<XCAFPrs_DocumentNode>& theNodes,
+                                           const Handle(AppDocument)&          theDocument,
+                                           const TDF_LabelSequence&                  theRoots,
+                                           const XCAFPrs_DocumentExplorerFlags       theFlags,
+                                           const XCAFPrs_Style& theDefStyle   = XCAFPrs_Style(),
+                                           const Standard_Boolean theToParallel = Standard_True);
+
 public:
   //! Empty constructor.
   Standard_EXPORT XCAFPrs_DocumentExplorer();
@@ -102,6 +102,7 @@
 #include <XCAFDoc_Volume.hxx>
 #include <XCAFPrs.hxx>
 #include <XCAFPrs_AISObject.hxx>
+#include <XCAFPrs_DocumentExplorer.hxx>
 #include <XCAFPrs_Driver.hxx>
 #include <XDEDRAW.hxx>
 #include <XDEDRAW_Colors.hxx>
@@ -770,7 +771,8 @@ private:
         myIsAutoTriang(-1),
         myToPrefixDocName(Standard_True),
         myToGetNames(Standard_True),
-        myToExplore(Standard_False)
+        myToExplore(Standard_False),
+        myToParallel(Standard_True)
   {
   }
 
@@ -778,8 +780,7 @@ private:
   Standard_Integer displayLabel(DrawInterpreter&              theDI,
                                 const DataLabel&               theLabel,
                                 const AsciiString1& theNamePrefix,
-                                const TopLoc_Location&         theLoc,
-                                AsciiString1&       theOutDispList)
+                                const TopLoc_Location&         theLoc)
   {
     AsciiString1 aName;
     if (myToGetNames)
@@ -828,7 +829,7 @@ private:
         const TopLoc_Location aLoc = theLoc * XCAFDoc_ShapeTool::GetLocation(theLabel);
         for (ChildIterator aChildIter(aRefLabel); aChildIter.More(); aChildIter.Next())
         {
-          if (displayLabel(theDI, aChildIter.Value(), aName, aLoc, theOutDispList) == 1)
+          if (displayLabel(theDI, aChildIter.Value(), aName, aLoc) == 1)
           {
             return 1;
           }
@@ -874,8 +875,9 @@ private:
       aPrs->Attributes()->SetAutoTriangulation(myIsAutoTriang == 1);
     }
 
-    ViewerTest1::Display(aName, aPrs, false);
-    theOutDispList += aName + " ";
+    // presentations are displayed after dispatching styles
+    myPrsList.Append(aPrs);
+    myPrsNames.Append(aName);
     return 0;
   }
 
@@ -957,6 +959,10 @@ private:
           myToExplore = !myToExplore;
         }
       }
+      else if (anArgCase == "-parallel" || anArgCase == "-noparallel")
+      {
+        myToParallel = Draw1::ParseOnOffNoIterator(theNbArgs, theArgVec, anArgIter);
+      }
       else if (anArgCase == "-outdisplist" && anArgIter + 1 < theNbArgs)
       {
         myOutDispListVar = theArgVec[++anArgIter];
@@ -1021,13 +1027,35 @@ private:
       if (displayLabel(theDI,
                        aLabel,
                        myToPrefixDocName ? myDocName + ":" : "",
-                       TopLoc_Location(),
-                       myOutDispList)
+                       TopLoc_Location())
           == 1)
       {
         return 1;
       }
     }
+
+    // map styles to sub-shapes concurrently before displaying presentations
+    if (!myPrsList.IsEmpty())
+    {
+      NCollection_Array1<Handle(XCAFPrs_AISObject)> aPrsArray(1, myPrsList.Size());
+      Standard_Integer                              aPrsIndex = 1;
+      for (NCollection_Sequence<Handle(XCAFPrs_AISObject)>::Iterator aPrsIter(myPrsList);
+           aPrsIter.More();
+           aPrsIter.Next(), ++aPrsIndex)
+      {
+        aPrsArray.SetValue(aPrsIndex, aPrsIter.Value());
+      }
+      XCAFPrs_AISObject::ParallelDispatchStyles(aPrsArray, Standard_False, myToParallel);
+    }
+
+    NCollection_Sequence<AsciiString1>::Iterator aNameIter(myPrsNames);
+    for (NCollection_Sequence<Handle(XCAFPrs_AISObject)>::Iterator aPrsIter(myPrsList);
+         aPrsIter.More();
+         aPrsIter.Next(), aNameIter.Next())
+    {
+      ViewerTest1::Display(aNameIter.Value(), aPrsIter.Value(), false);
+      myOutDispList += aNameIter.Value() + " ";
+    }
     if (myOutDispListVar.IsEmpty())
     {
       theDI << myOutDispList;
@@ -1046,14 +1074,91 @@ private:
   AsciiString1 myOutDispListVar;           //!< tcl variable to print the result objects
   AsciiString1 myOutDispList;     //!< string with list of all displayed object names
   TDF_LabelSequence       myLabels;          //!< labels to display
+  NCollection_Sequence<Handle(XCAFPrs_AISObject)> myPrsList;  //!< presentations to display
+  NCollection_Sequence<AsciiString1>              myPrsNames; //!< names of presentations
   Standard_Integer        myDispMode;        //!< shape display mode
   Standard_Integer        myHiMode;          //!< shape highlight mode
   Standard_Integer        myIsAutoTriang;    //!< auto-triangulation mode
   Standard_Boolean        myToPrefixDocName; //!< flag to prefix objects with document name
   Standard_Boolean        myToGetNames;      //!< flag to use label names or tags
   Standard_Boolean        myToExplore;       //!< flag to explore assembles
+  Standard_Boolean        myToParallel;      //!< flag to dispatch styles in several threads
 };
 
+//! Print the node identifier and its style.
+static void dumpDocumentNode(DrawInterpreter& theDI, const XCAFPrs_DocumentNode& theNode)
+{
+  theDI << theNode.Id << (theNode.IsAssembly ? " assembly" : " part");
+  if (theNode.Style.IsSetColorSurf())
+  {
+    theDI << " " << Color1::ColorToHex(theNode.Style.GetColorSurf());
+  }
+  if (!theNode.Style.IsVisible())
+  {
+    theDI << " hidden";
+  }
+  theDI << "\n";
+}
+
+//=================================================================================================
+
+static Standard_Integer XDumpNodes(DrawInterpreter& theDI,
+                                   Standard_Integer theNbArgs,
+                                   const char**     theArgVec)
+{
+  Handle(AppDocument)           aDoc;
+  Standard_Boolean              toParallel = Standard_True;
+  XCAFPrs_DocumentExplorerFlags aFlags     = XCAFPrs_DocumentExplorerFlags_None;
+  for (Standard_Integer anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
+  {
+    AsciiString1 anArgCase(theArgVec[anArgIter]);
+    anArgCase.LowerCase();
+    if (anArgCase == "-leaves" || anArgCase == "-onlyleaves")
+    {
+      aFlags |= XCAFPrs_DocumentExplorerFlags_OnlyLeafNodes;
+    }
+    else if (anArgCase == "-parallel" || anArgCase == "-noparallel")
+    {
+      toParallel = Draw1::ParseOnOffNoIterator(theNbArgs, theArgVec, anArgIter);
+    }
+    else if (aDoc.IsNull() && DDocStd1::GetDocument(theArgVec[anArgIter], aDoc, Standard_False))
+    {
+      continue;
+    }
+    else
+    {
+      theDI << "Syntax error at '" << theArgVec[anArgIter] << "'";
+      return 1;
+    }
+  }
+  if (aDoc.IsNull())
+  {
+    theDI << "Syntax error: not enough arguments";
+    return 1;
+  }
+
+  TDF_LabelSequence aRoots;
+  XCAFDoc_DocumentTool::ShapeTool(aDoc->Main())->GetFreeShapes(aRoots);
+  if (toParallel)
+  {
+    NCollection_Vector<XCAFPrs_DocumentNode> aNodes;
+    XCAFPrs_DocumentExplorer::CollectNodes(aNodes, aDoc, aRoots, aFlags);
+    for (NCollection_Vector<XCAFPrs_DocumentNode>::Iterator aNodeIter(aNodes); aNodeIter.More();
+         aNodeIter.Next())
+    {
+      dumpDocumentNode(theDI, aNodeIter.Value());
+    }
+  }
+  else
+  {
+    for (XCAFPrs_DocumentExplorer aDocExp(aDoc, aRoots, aFlags); aDocExp.More(); aDocExp.Next())
+    {
+      dumpDocumentNode(theDI, aDocExp.Current());
+    }
+  }
+  return 0;
+}
+
 //=================================================================================================
 
 static Standard_Integer xwd(DrawInterpreter& di, Standard_Integer argc, const char** argv)
@@ -1917,6 +2022,7 @@ void XDEDRAW1::Init(DrawInterpreter& di)
          "XDisplay Doc [label1 [label2 [...]]] [-explore {on|off}] [-docPrefix {on|off}] [-names "
          "{on|off}]"
          "\n\t\t:      [-noupdate] [-dispMode Mode] [-highMode Mode] [-autoTriangulation {0|1}]"
+         "\n\t\t:      [-parallel {on|off}]"
          "\n\t\t: Displays document (parts) in 3D Viewer."
          "\n\t\t:  -dispMode    Presentation display mode."
          "\n\t\t:  -highMode    Presentation highlight mode."
@@ -1925,11 +2031,22 @@ void XDEDRAW1::Init(DrawInterpreter& di)
          "\n\t\t:  -explore     Explode labels to leaves; FALSE by default."
          "\n\t\t:  -outDispList Set the TCL variable to the list of displayed object names."
          "\n\t\t:               (instead of printing them to draw interpreter)"
-         "\n\t\t:  -autoTriang  Enable/disable auto-triangulation for displayed shapes.",
+         "\n\t\t:  -autoTriang  Enable/disable auto-triangulation for displayed shapes."
+         "\n\t\t:  -parallel    Dispatch styles of displayed objects in several threads; TRUE by default.",
          __FILE__,
          XDEDRAW_XDisplayTool::XDisplay,
          g);
 
+  di.Add("XDumpNodes",
+         "XDumpNodes Doc [-leaves] [-parallel {on|off}]"
+         "\n\t\t: Prints the flattened tree of document nodes with resolved styles."
+         "\n\t\t:  -leaves   Skip assembly nodes."
+         "\n\t\t:  -parallel Resolve nodes in several threads; TRUE by default."
+         "\n\t\t:            Otherwise, nodes are iterated by XCAFPrs_DocumentExplorer.",
+         __FILE__,
+         XDumpNodes,
+         g);
+
   di.Add("XWdump",
          "Doc filename.{gif|xwd|bmp} \t: Dump contents of viewer window to XWD, GIF or BMP file",
          __FILE__,
@@ -68,3 +68,35 @@ void XmlDrivers_DocumentRetrievalDriver::ShapeSetCleaning(const Handle(XmlMDF_AD
   if (aNamedShapeDriver.IsNull() == Standard_False)
     aNamedShapeDriver->Clear();
 }
+
+//=================================================================================================
+
+Handle(PCDM_RetrievalDriver) XmlDrivers_DocumentRetrievalDriver::Copy() const
+{
+  Handle(XmlDrivers_DocumentRetrievalDriver) aCopy = new XmlDrivers_DocumentRetrievalDriver();
+  if (!InitCopy(aCopy))
+  {
+    return Handle(PCDM_RetrievalDriver)();
+  }
+  return aCopy;
+}
+
+//=================================================================================================
+
+Standard_Boolean XmlDrivers_DocumentRetrievalDriver::InitCopy(
+  const Handle(XmlDrivers_DocumentRetrievalDriver)& theCopy) const
+{
+  XmlLDrivers_DocumentRetrievalDriver::InitCopy(theCopy);
+  Handle(XmlMDF_ADriver) aDriver;
+  if (theCopy->myDrivers.IsNull()
+      || !theCopy->myDrivers->GetDriver(STANDARD_TYPE(ShapeAttribute), aDriver))
+  {
+    return Standard_True;
+  }
+  if (aDriver->DynamicType() != STANDARD_TYPE(XmlMNaming_NamedShapeDriver))
+  {
+    return Standard_False;
+  }
+  theCopy->myDrivers->AddDriver(new XmlMNaming_NamedShapeDriver(aDriver->MessageDriver()));
+  return Standard_True;
+}
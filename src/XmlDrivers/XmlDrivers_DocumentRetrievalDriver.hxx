@@ -45,7 +45,17 @@ public:
   Standard_EXPORT virtual void ShapeSetCleaning(const Handle(XmlMDF_ADriver)& theDriver)
     Standard_OVERRIDE;
 
+  //! Returns a new driver of the same type, with the format and options of this driver.
+  Standard_EXPORT virtual Handle(PCDM_RetrievalDriver) Copy() const Standard_OVERRIDE;
+
   DEFINE_STANDARD_RTTIEXT(XmlDrivers_DocumentRetrievalDriver, XmlLDrivers_DocumentRetrievalDriver)
+
+protected:
+  //! Passes the format and the attribute drivers of this driver to its copy;
+  //! the copy gets its own driver of shapes, as this one keeps the shapes
+  //! of the document being read.
+  //! Returns FALSE if the driver of shapes is redefined by the application and cannot be duplicated.
+  Standard_EXPORT Standard_Boolean InitCopy(const Handle(XmlDrivers_DocumentRetrievalDriver)& theCopy) const;
 };
 
 #endif // _XmlDrivers_DocumentRetrievalDriver_HeaderFile
@@ -61,3 +61,35 @@ Standard_Boolean XmlDrivers_DocumentStorageDriver::WriteShapeSection(
   }
   return isShape;
 }
+
+//=================================================================================================
+
+Handle(PCDM_StorageDriver) XmlDrivers_DocumentStorageDriver::Copy() const
+{
+  Handle(XmlDrivers_DocumentStorageDriver) aCopy = new XmlDrivers_DocumentStorageDriver(Copyright());
+  if (!InitCopy(aCopy))
+  {
+    return Handle(PCDM_StorageDriver)();
+  }
+  return aCopy;
+}
+
+//=================================================================================================
+
+Standard_Boolean XmlDrivers_DocumentStorageDriver::InitCopy(
+  const Handle(XmlDrivers_DocumentStorageDriver)& theCopy) const
+{
+  XmlLDrivers_DocumentStorageDriver::InitCopy(theCopy);
+  Handle(XmlMDF_ADriver) aDriver;
+  if (theCopy->myDrivers.IsNull()
+      || !theCopy->myDrivers->GetDriver(STANDARD_TYPE(ShapeAttribute), aDriver))
+  {
+    return Standard_True;
+  }
+  if (aDriver->DynamicType() != STANDARD_TYPE(XmlMNaming_NamedShapeDriver))
+  {
+    return Standard_False;
+  }
+  theCopy->myDrivers->AddDriver(new XmlMNaming_NamedShapeDriver(aDriver->MessageDriver()));
+  return Standard_True;
+}
@@ -41,7 +41,17 @@ public:
     const TDocStd_FormatVersion  theStorageFormatVersion,
     const Message_ProgressRange& theRange = Message_ProgressRange()) Standard_OVERRIDE;
 
+  //! Returns a new driver of the same type, with the format and options of this driver.
+  Standard_EXPORT virtual Handle(PCDM_StorageDriver) Copy() const Standard_OVERRIDE;
+
   DEFINE_STANDARD_RTTIEXT(XmlDrivers_DocumentStorageDriver, XmlLDrivers_DocumentStorageDriver)
+
+protected:
+  //! Passes the format and the attribute drivers of this driver to its copy;
+  //! the copy gets its own driver of shapes, as this one keeps the shapes
+  //! of the document being written.
+  //! Returns FALSE if the driver of shapes is redefined by the application and cannot be duplicated.
+  Standard_EXPORT Standard_Boolean InitCopy(const Handle(XmlDrivers_DocumentStorageDriver)& theCopy) const;
 };
 
 #endif // _XmlDrivers_DocumentStorageDriver_HeaderFile
@@ -454,7 +454,11 @@ void XmlLDrivers_DocumentRetrievalDriver::ReadFromDomDocument(
   Message_ProgressScope aPS(theRange, "Reading document", 2);
   // 2. Read Shapes section
   if (myDrivers.IsNull())
-    myDrivers = AttributeDrivers(aMsgDriver);
+  {
+    Handle(XmlMDF_ADriverTable) aDrivers = AttributeDrivers(aMsgDriver);
+    Standard_Mutex::Sentry      aLock(myDriversMutex);
+    myDrivers = aDrivers;
+  }
   const Handle(XmlMDF_ADriver) aNSDriver = ReadShapeSection(theElement, aMsgDriver, aPS.Next());
   if (!aNSDriver.IsNull())
     ::take_time(0, " +++++ Fin reading Shapes :    ", aMsgDriver);
@@ -593,3 +597,27 @@ void XmlLDrivers_DocumentRetrievalDriver::ShapeSetCleaning(
   const Handle(XmlMDF_ADriver)& /*theDriver*/)
 {
 }
+
+//=================================================================================================
+
+Handle(PCDM_RetrievalDriver) XmlLDrivers_DocumentRetrievalDriver::Copy() const
+{
+  Handle(XmlLDrivers_DocumentRetrievalDriver) aCopy = new XmlLDrivers_DocumentRetrievalDriver();
+  InitCopy(aCopy);
+  return aCopy;
+}
+
+//=================================================================================================
+
+void XmlLDrivers_DocumentRetrievalDriver::InitCopy(
+  const Handle(XmlLDrivers_DocumentRetrievalDriver)& theCopy) const
+{
+  theCopy->SetFormat(GetFormat());
+
+  // the copy shares the attribute drivers, including the ones added by the application
+  Standard_Mutex::Sentry aLock(myDriversMutex);
+  if (!myDrivers.IsNull())
+  {
+    theCopy->myDrivers = myDrivers->Copy();
+  }
+}
@@ -58,9 +58,15 @@ public:
   Standard_EXPORT virtual Handle(XmlMDF_ADriverTable) AttributeDrivers(
     const Handle(Message_Messenger)& theMsgDriver);
 
+  //! Returns a new driver of the same type, with the format and options of this driver.
+  Standard_EXPORT virtual Handle(PCDM_RetrievalDriver) Copy() const Standard_OVERRIDE;
+
   DEFINE_STANDARD_RTTIEXT(XmlLDrivers_DocumentRetrievalDriver, PCDM_RetrievalDriver)
 
 protected:
+  //! Passes the format and the table of attribute drivers of this driver to its copy.
+  Standard_EXPORT void InitCopy(const Handle(XmlLDrivers_DocumentRetrievalDriver)& theCopy) const;
+
   Standard_EXPORT virtual void ReadFromDomDocument(
     const XmlObjMgt_Element&       theDomElement,
     const Handle(CDM_Document)&    theNewDocument,
@@ -80,6 +86,8 @@ protected:
   Standard_EXPORT virtual void ShapeSetCleaning(const Handle(XmlMDF_ADriver)& theDriver);
 
   Handle(XmlMDF_ADriverTable) myDrivers;
+  //! guards the creation of myDrivers while reading against its copying by another thread
+  mutable Standard_Mutex myDriversMutex;
   XmlObjMgt_RRelocationTable  myRelocTable;
   UtfString  myFileName;
 
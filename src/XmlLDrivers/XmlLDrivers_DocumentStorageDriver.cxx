@@ -393,7 +393,11 @@ Standard_Integer XmlLDrivers_DocumentStorageDriver::MakeDocument(
     else
       aMessageDriver = anApplication->MessageDriver();
     if (myDrivers.IsNull())
-      myDrivers = AttributeDrivers(aMessageDriver);
+    {
+      Handle(XmlMDF_ADriverTable) aDrivers = AttributeDrivers(aMessageDriver);
+      Standard_Mutex::Sentry      aLock(myDriversMutex);
+      myDrivers = aDrivers;
+    }
 
     //      Retrieve from DOM_Document
     XmlMDF1::FromTo(aTDF, theElement, myRelocTable, myDrivers, theRange);
@@ -465,3 +469,27 @@ Standard_Boolean XmlLDrivers_DocumentStorageDriver::WriteShapeSection(
   // empty; should be redefined in subclasses
   return Standard_False;
 }
+
+//=================================================================================================
+
+Handle(PCDM_StorageDriver) XmlLDrivers_DocumentStorageDriver::Copy() const
+{
+  Handle(XmlLDrivers_DocumentStorageDriver) aCopy = new XmlLDrivers_DocumentStorageDriver(Copyright());
+  InitCopy(aCopy);
+  return aCopy;
+}
+
+//=================================================================================================
+
+void XmlLDrivers_DocumentStorageDriver::InitCopy(
+  const Handle(XmlLDrivers_DocumentStorageDriver)& theCopy) const
+{
+  theCopy->SetFormat(GetFormat());
+
+  // the copy shares the attribute drivers, including the ones added by the application
+  Standard_Mutex::Sentry aLock(myDriversMutex);
+  if (!myDrivers.IsNull())
+  {
+    theCopy->myDrivers = myDrivers->Copy();
+  }
+}
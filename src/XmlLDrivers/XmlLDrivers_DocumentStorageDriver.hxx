@@ -54,9 +54,18 @@ public:
   Standard_EXPORT virtual Handle(XmlMDF_ADriverTable) AttributeDrivers(
     const Handle(Message_Messenger)& theMsgDriver);
 
+  //! Returns a new driver of the same type, with the format and options of this driver.
+  //! Returns the copyright written into the stored documents.
+  const UtfString& Copyright() const { return myCopyright; }
+
+  Standard_EXPORT virtual Handle(PCDM_StorageDriver) Copy() const Standard_OVERRIDE;
+
   DEFINE_STANDARD_RTTIEXT(XmlLDrivers_DocumentStorageDriver, PCDM_StorageDriver)
 
 protected:
+  //! Passes the format and the table of attribute drivers of this driver to its copy.
+  Standard_EXPORT void InitCopy(const Handle(XmlLDrivers_DocumentStorageDriver)& theCopy) const;
+
   Standard_EXPORT virtual Standard_Boolean WriteToDomDocument(
     const Handle(CDM_Document)&  theDocument,
     XmlObjMgt_Element&           thePDoc,
@@ -76,6 +85,8 @@ protected:
     const Message_ProgressRange& theRange = Message_ProgressRange());
 
   Handle(XmlMDF_ADriverTable) myDrivers;
+  //! guards the creation of myDrivers while writing against its copying by another thread
+  mutable Standard_Mutex myDriversMutex;
   XmlObjMgt_SRelocationTable  myRelocTable;
 
 private:
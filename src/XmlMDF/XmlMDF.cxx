@@ -40,12 +40,6 @@ IMPLEMENT_DOMSTRING(LabelString, "label")
 // #define DATATYPE_MIGRATION_DEB
 //=================================================================================================
 
-static TColStd_MapOfTransient& UnsuppTypesMap()
-{
-  static TColStd_MapOfTransient anUnsuppTypes;
-  return anUnsuppTypes;
-}
-
 //=======================================================================
 // function : FromTo
 // purpose  : Paste transient data into DOM_Element
@@ -56,10 +50,10 @@ void XmlMDF1::FromTo(const Handle(Data2)&            theData,
                     const Handle(XmlMDF_ADriverTable)& theDrivers,
                     const Message_ProgressRange&       theRange)
 {
-  UnsuppTypesMap().Clear();
+  // types reported as unsupported, kept per operation as documents might be written concurrently
+  TColStd_MapOfTransient anUnsuppTypes;
   //  Standard_Integer count =
-  WriteSubTree(theData->Root(), theElement, theRelocTable, theDrivers, theRange);
-  UnsuppTypesMap().Clear();
+  WriteSubTree(theData->Root(), theElement, theRelocTable, theDrivers, anUnsuppTypes, theRange);
 }
 
 //=================================================================================================
@@ -68,8 +62,10 @@ Standard_Integer XmlMDF1::WriteSubTree(const DataLabel&                   theLab
                                       XmlObjMgt_Element&                 theElement,
                                       XmlObjMgt_SRelocationTable&        theRelocTable,
                                       const Handle(XmlMDF_ADriverTable)& theDrivers,
+                                      TColStd_MapOfTransient&            theUnsuppTypes,
                                       const Message_ProgressRange&       theRange)
 {
+  (void)theUnsuppTypes; // reported in debug mode only
   XmlObjMgt_Document aDoc = theElement.getOwnerDocument();
 
   // create element "label"
@@ -108,10 +104,9 @@ Standard_Integer XmlMDF1::WriteSubTree(const DataLabel&                   theLab
       aDriver->Paste(tAtt, pAtt, theRelocTable);
     }
 #ifdef OCCT_DEBUG
-    else if (!UnsuppTypesMap().Contains(aType))
+    else if (theUnsuppTypes.Add(aType))
     {
       std::cout << "attribute driver for type " << aType->Name() << " not found" << std::endl;
-      UnsuppTypesMap().Add(aType);
     }
 #endif
   }
@@ -127,7 +122,8 @@ Standard_Integer XmlMDF1::WriteSubTree(const DataLabel&                   theLab
   for (; itr2.More() && aPS.More(); itr2.Next())
   {
     const DataLabel& aChildLab = itr2.Value();
-    count += WriteSubTree(aChildLab, aLabElem, theRelocTable, theDrivers, aPS.Next());
+    count +=
+      WriteSubTree(aChildLab, aLabElem, theRelocTable, theDrivers, theUnsuppTypes, aPS.Next());
   }
 
   if (count > 0 || TDocStd_Owner::GetDocument(theLabel.Data())->EmptyLabelsSavingMode())
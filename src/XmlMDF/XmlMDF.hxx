@@ -23,6 +23,7 @@
 #include <XmlObjMgt_Element.hxx>
 #include <Standard_Integer.hxx>
 #include <XmlMDF_MapOfDriver.hxx>
+#include <TColStd_MapOfTransient.hxx>
 
 #include <Message_ProgressRange.hxx>
 
@@ -81,6 +82,7 @@ private:
     XmlObjMgt_Element&                 theElement,
     XmlObjMgt_SRelocationTable&        aReloc,
     const Handle(XmlMDF_ADriverTable)& aDrivers,
+    TColStd_MapOfTransient&            theUnsuppTypes,
     const Message_ProgressRange&       theRange = Message_ProgressRange());
 
   Standard_EXPORT static Standard_Integer ReadSubTree(
@@ -31,6 +31,7 @@ XmlMDF_ADriverTable::XmlMDF_ADriverTable() {}
 void XmlMDF_ADriverTable::AddDriver(const Handle(XmlMDF_ADriver)& anHDriver)
 {
   const Handle(TypeInfo)& type = anHDriver->SourceType();
+  Standard_Mutex::Sentry       aLock(myMutex);
 
   // to make possible for applications to redefine standard attribute drivers
   myMap.UnBind(type);
@@ -51,6 +52,7 @@ void XmlMDF_ADriverTable::AddDerivedDriver(const Handle(TDF_Attribute)& theInsta
       if (myMap.IsBound(aType))
       {
         Handle(XmlMDF_ADriver) aDriver = new XmlMDF_DerivedDriver(theInstance, myMap(aType));
+        Standard_Mutex::Sentry aLock(myMutex);
         myMap.Bind(anInstanceType, aDriver);
         return;
       }
@@ -120,3 +122,13 @@ void XmlMDF_ADriverTable::CreateDrvMap(XmlMDF_MapOfDriver& theDriverMap)
     }
   }
 }
+
+//=================================================================================================
+
+Handle(XmlMDF_ADriverTable) XmlMDF_ADriverTable::Copy() const
+{
+  Handle(XmlMDF_ADriverTable) aCopy = new XmlMDF_ADriverTable();
+  Standard_Mutex::Sentry      aLock(myMutex);
+  aCopy->myMap.Assign(myMap);
+  return aCopy;
+}
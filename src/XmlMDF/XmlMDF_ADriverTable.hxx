@@ -22,6 +22,7 @@
 #include <Standard_Transient.hxx>
 #include <Standard_Boolean.hxx>
 #include <Standard_Type.hxx>
+#include <Standard_Mutex.hxx>
 #include <XmlMDF_MapOfDriver.hxx>
 class XmlMDF_ADriver;
 
@@ -60,11 +61,18 @@ public:
   Standard_EXPORT Standard_Boolean GetDriver(const Handle(TypeInfo)& theType,
                                              Handle(XmlMDF_ADriver)&      theDriver);
 
+  //! Returns a new table sharing the drivers of this one, to be used by a copy
+  //! of the document driver.
+  //! The drivers keeping the data of the document being translated should be replaced in the copy.
+  Standard_EXPORT Handle(XmlMDF_ADriverTable) Copy() const;
+
   DEFINE_STANDARD_RTTIEXT(XmlMDF_ADriverTable, RefObject)
 
 protected:
 private:
   XmlMDF_TypeADriverMap myMap;
+  //! guards the modifications of myMap against its copying by another thread
+  mutable Standard_Mutex myMutex;
 };
 
 #endif // _XmlMDF_ADriverTable_HeaderFile
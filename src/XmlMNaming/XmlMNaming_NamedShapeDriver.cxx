@@ -19,6 +19,7 @@
 #include <Message_Messenger.hxx>
 #include <Message_ProgressScope.hxx>
 #include <LDOM_OSStream.hxx>
+#include <Standard_ArrayStreamBuffer.hxx>
 #include <LDOM_Text.hxx>
 #include <Standard_SStream.hxx>
 #include <Standard_Type.hxx>
@@ -336,8 +337,11 @@ void XmlMNaming_NamedShapeDriver::ReadShapeSection(const XmlObjMgt_Element&
     {
       if (aNode.getNodeType() == LDOM_Node::TEXT_NODE)
       {
+        // read the shapes directly from the text kept by the document, without copying it
         LDOMString        aData = aNode.getNodeValue();
-        std::stringstream aStream(std::string(aData.GetString()));
+        Standard_CString  aText = aData.GetString();
+        ArrayStreamBuffer aBuffer(aText, strlen(aText));
+        Standard_IStream  aStream(&aBuffer);
         myShapeSet.Clear();
         myShapeSet.Read(aStream, theRange);
         break;
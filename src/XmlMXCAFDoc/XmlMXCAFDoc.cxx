@@ -17,6 +17,7 @@
 
 #include <Message_Messenger.hxx>
 #include <TNaming_NamedShape.hxx>
+#include <XCAFDoc_Location.hxx>
 #include <XmlMDF_ADriverTable.hxx>
 #include <XmlMNaming_NamedShapeDriver.hxx>
 #include <XmlMXCAFDoc_AssemblyItemRefDriver.hxx>
@@ -65,3 +66,33 @@ void XmlMXCAFDoc1::AddDrivers(const Handle(XmlMDF_ADriverTable)& aDriverTable,
   aDriverTable->AddDriver(new XmlMXCAFDoc_NoteBinDataDriver(anMsgDrv));
   aDriverTable->AddDriver(new XmlMXCAFDoc_VisMaterialToolDriver(anMsgDrv));
 }
+
+//=================================================================================================
+
+Standard_Boolean XmlMXCAFDoc1::RelinkLocationDriver(
+  const Handle(XmlMDF_ADriverTable)& theDriverTable)
+{
+  Handle(XmlMDF_ADriver) aDriver;
+  if (!theDriverTable->GetDriver(STANDARD_TYPE(XCAFDoc_Location), aDriver))
+  {
+    return Standard_True;
+  }
+  if (aDriver->DynamicType() != STANDARD_TYPE(XmlMXCAFDoc_LocationDriver))
+  {
+    return Standard_False;
+  }
+
+  Handle(XmlMDF_ADriver) aNSDriver;
+  theDriverTable->GetDriver(STANDARD_TYPE(ShapeAttribute), aNSDriver);
+  Handle(XmlMNaming_NamedShapeDriver) aNamedShapeDriver =
+    Handle(XmlMNaming_NamedShapeDriver)::DownCast(aNSDriver);
+
+  Handle(XmlMXCAFDoc_LocationDriver) aLocationDriver =
+    new XmlMXCAFDoc_LocationDriver(aDriver->MessageDriver());
+  if (!aNamedShapeDriver.IsNull())
+  {
+    aLocationDriver->SetSharedLocations(&(aNamedShapeDriver->GetShapesLocations()));
+  }
+  theDriverTable->AddDriver(aLocationDriver);
+  return Standard_True;
+}
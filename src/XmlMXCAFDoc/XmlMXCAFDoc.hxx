@@ -33,6 +33,13 @@ public:
   //! Adds the attribute drivers to <aDriverTable>.
   Standard_EXPORT static void AddDrivers(const Handle(XmlMDF_ADriverTable)& aDriverTable,
                                          const Handle(Message_Messenger)&   anMsgDrv);
+
+  //! Replaces the driver of locations in <theDriverTable> by a new one sharing the locations
+  //! of the driver of shapes of this table. It is used for the tables copied for the copies
+  //! of document drivers, in which the driver of shapes is replaced.
+  //! Returns FALSE if the driver of locations is redefined and cannot be replaced.
+  Standard_EXPORT static Standard_Boolean RelinkLocationDriver(
+    const Handle(XmlMDF_ADriverTable)& theDriverTable);
 };
 
 #endif // _XmlMXCAFDoc_HeaderFile
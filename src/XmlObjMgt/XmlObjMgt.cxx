@@ -27,6 +27,69 @@ static const char aRefPrefix[] = "/document/label";
 static const char aRefElem1[]  = "/label[@tag=";
 static const char aRefElem2[]  = "]";
 
+namespace
+{
+//! Exactly representable powers of ten.
+static const double THE_POW10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                   1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                   1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+//! Parses a decimal number which mantissa and power of ten are both exactly representable
+//! by double, so that the result is computed by a single correctly rounded operation.
+//! Returns FALSE for any other input (more digits, hexadecimal, NaN etc.) which should be
+//! passed to the complete conversion Strtod().
+static Standard_Boolean fastStrtod(const char* theStr, const char*& theEnd, double& theValue)
+{
+  const char* aPtr = theStr;
+  while (IsSpace(*aPtr))
+    ++aPtr;
+  const Standard_Boolean isNegative = (*aPtr == '-');
+  if (*aPtr == '-' || *aPtr == '+')
+    ++aPtr;
+
+  uint64_t         aMantissa  = 0;
+  Standard_Integer aNbDigits  = 0;
+  Standard_Integer anExponent = 0;
+  for (; *aPtr >= '0' && *aPtr <= '9'; ++aPtr, ++aNbDigits)
+    aMantissa = aMantissa * 10 + (*aPtr - '0');
+  if (*aPtr == '.')
+  {
+    for (++aPtr; *aPtr >= '0' && *aPtr <= '9'; ++aPtr, ++aNbDigits, --anExponent)
+      aMantissa = aMantissa * 10 + (*aPtr - '0');
+  }
+  // more than 19 digits may overflow the mantissa
+  if (aNbDigits == 0 || aNbDigits > 19)
+    return Standard_False;
+
+  if (*aPtr == 'e' || *aPtr == 'E')
+  {
+    ++aPtr;
+    const Standard_Boolean isNegExp = (*aPtr == '-');
+    if (*aPtr == '-' || *aPtr == '+')
+      ++aPtr;
+    if (*aPtr < '0' || *aPtr > '9')
+      return Standard_False;
+    Standard_Integer anExpValue = 0;
+    for (; *aPtr >= '0' && *aPtr <= '9' && anExpValue < 10000; ++aPtr)
+      anExpValue = anExpValue * 10 + (*aPtr - '0');
+    anExponent += isNegExp ? -anExpValue : anExpValue;
+  }
+
+  // the rest (including "#QNAN" of old MSVC run-time) is analyzed by the caller
+  if (*aPtr != '\0' && *aPtr != '#' && !IsSpace(*aPtr))
+    return Standard_False;
+  if (aMantissa > (uint64_t(1) << 53) || anExponent < -22 || anExponent > 22)
+    return Standard_False;
+
+  theValue = double(aMantissa);
+  theValue = anExponent < 0 ? theValue / THE_POW10[-anExponent] : theValue * THE_POW10[anExponent];
+  if (isNegative)
+    theValue = -theValue;
+  theEnd = aPtr;
+  return Standard_True;
+}
+} // namespace
+
 //=======================================================================
 // function : IdString
 // purpose  : return name of ID attribute to be used everywhere
@@ -331,11 +394,16 @@ Standard_Boolean XmlObjMgt1::GetInteger(Standard_CString& theString, Standard_In
 
 Standard_Boolean XmlObjMgt1::GetReal(Standard_CString& theString, Standard_Real& theValue)
 {
-  char* ptr;
-  errno    = 0;
-  theValue = Strtod(theString, &ptr);
-  if (ptr == theString || errno == ERANGE || errno == EINVAL)
-    return Standard_False;
+  const char* ptr = theString;
+  if (!fastStrtod(theString, ptr, theValue))
+  {
+    char* anEnd;
+    errno    = 0;
+    theValue = Strtod(theString, &anEnd);
+    if (anEnd == theString || errno == ERANGE || errno == EINVAL)
+      return Standard_False;
+    ptr = anEnd;
+  }
 
   theString = ptr;
 
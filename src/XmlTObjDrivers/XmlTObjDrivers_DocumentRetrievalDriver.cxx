@@ -39,3 +39,12 @@ Handle(XmlMDF_ADriverTable) XmlTObjDrivers_DocumentRetrievalDriver::AttributeDri
 
   return aTable;
 }
+
+//=================================================================================================
+
+Handle(PCDM_RetrievalDriver) XmlTObjDrivers_DocumentRetrievalDriver::Copy() const
+{
+  Handle(XmlTObjDrivers_DocumentRetrievalDriver) aCopy = new XmlTObjDrivers_DocumentRetrievalDriver();
+  InitCopy(aCopy);
+  return aCopy;
+}
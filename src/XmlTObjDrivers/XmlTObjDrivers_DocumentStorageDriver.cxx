@@ -42,3 +42,12 @@ Handle(XmlMDF_ADriverTable) XmlTObjDrivers_DocumentStorageDriver::AttributeDrive
 
   return aTable;
 }
+
+//=================================================================================================
+
+Handle(PCDM_StorageDriver) XmlTObjDrivers_DocumentStorageDriver::Copy() const
+{
+  Handle(XmlTObjDrivers_DocumentStorageDriver) aCopy = new XmlTObjDrivers_DocumentStorageDriver(Copyright());
+  InitCopy(aCopy);
+  return aCopy;
+}
@@ -40,3 +40,16 @@ Handle(XmlMDF_ADriverTable) XmlXCAFDrivers_DocumentRetrievalDriver::AttributeDri
 
   return aTable;
 }
+
+//=================================================================================================
+
+Handle(PCDM_RetrievalDriver) XmlXCAFDrivers_DocumentRetrievalDriver::Copy() const
+{
+  Handle(XmlXCAFDrivers_DocumentRetrievalDriver) aCopy = new XmlXCAFDrivers_DocumentRetrievalDriver();
+  if (!InitCopy(aCopy)
+      || (!aCopy->myDrivers.IsNull() && !XmlMXCAFDoc1::RelinkLocationDriver(aCopy->myDrivers)))
+  {
+    return Handle(PCDM_RetrievalDriver)();
+  }
+  return aCopy;
+}
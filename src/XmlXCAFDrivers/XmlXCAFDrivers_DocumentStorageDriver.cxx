@@ -45,3 +45,16 @@ Handle(XmlMDF_ADriverTable) XmlXCAFDrivers_DocumentStorageDriver::AttributeDrive
 
   return aTable;
 }
+
+//=================================================================================================
+
+Handle(PCDM_StorageDriver) XmlXCAFDrivers_DocumentStorageDriver::Copy() const
+{
+  Handle(XmlXCAFDrivers_DocumentStorageDriver) aCopy = new XmlXCAFDrivers_DocumentStorageDriver(Copyright());
+  if (!InitCopy(aCopy)
+      || (!aCopy->myDrivers.IsNull() && !XmlMXCAFDoc1::RelinkLocationDriver(aCopy->myDrivers)))
+  {
+    return Handle(PCDM_StorageDriver)();
+  }
+  return aCopy;
+}